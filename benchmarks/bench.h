@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+
+/// @brief Prevent the compiler from optimizing away the computation of `val`.
+template <typename T>
+inline void do_not_optimize(T const &val) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(val) : "memory");
+#else
+    static volatile char const *sink;
+    sink = reinterpret_cast<char const volatile *>(&val);
+#endif
+}
+
+/// @brief Run `func` `repetitions` times and return the fastest run, in
+/// nanoseconds.
+template <typename Func>
+[[nodiscard]] auto measure_ns(Func &&func, int repetitions = 11) -> double {
+    using clock_t = std::chrono::steady_clock;
+
+    double best{-1};
+    for (int i{}; i != repetitions; ++i) {
+        auto const start = clock_t::now();
+        func();
+        auto const stop = clock_t::now();
+
+        double const elapsed =
+            std::chrono::duration<double, std::nano>(stop - start).count();
+        best = best < 0 ? elapsed : std::min(best, elapsed);
+    }
+
+    return best;
+}
+
+/// @brief Print one result line: the benchmark name, the time per item and
+/// the throughput.
+/// @param name The benchmark name.
+/// @param ns The time to process all of the items, in nanoseconds.
+/// @param items The number of processed items.
+/// @param bytes The number of bytes read or written.
+inline void report(char const *name, double ns, std::size_t items,
+                   std::size_t bytes) {
+    std::printf("%-40s %10.3f ns/item %10.3f GB/s\n", name,
+                ns / static_cast<double>(items),
+                static_cast<double>(bytes) / ns);
+}
+
+} // namespace bench
@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""Measure how the compile time and the compiler memory scale with the arity
+of a tuple.
+
+For each (library, operation, arity) triple, generate a translation unit that
+instantiates that operation (see operations.h) and compile it, recording the
+wall time and the peak resident memory of the compiler. The results are
+written as a JSON report; if a previous report is given, the cases that got
+slower (or hungrier) than a threshold are listed and the script fails.
+
+Only GCC-like compiler drivers are supported (GCC, Clang).
+"""
+
+import argparse
+import json
+import os
+import platform
+import resource
+import shlex
+import signal
+import subprocess
+import sys
+import threading
+import time
+
+LIBRARIES = ["tr", "std"]
+
+OPERATIONS = [
+    "baseline",
+    "construction",
+    "get",
+    "swap",
+    "conversion",
+    "unpack",
+    "for_each",
+    "fold_left",
+    "fold_left_first",
+    "all_of",
+    "count_if",
+    "tuple_element",
+    "sequence_at",
+    "views",
+    "nested_views",
+]
+
+ARITIES = [8, 32, 128, 512, 1024]
+
+TRANSLATION_UNIT = """\
+// Generated by compile_bench.py: {operation}, {library}, {arity} elements.
+#include "operations.h"
+
+int main() {{
+    compile_bench::{operation}(compile_bench::{library}_lib{{}},
+                               std::make_index_sequence<{arity}>{{}});
+}}
+"""
+
+
+def parse_list(text, convert=str):
+    return [convert(item) for item in text.replace(";", ",").split(",") if item]
+
+
+def generate(work_dir, library, operation, arity):
+    path = os.path.join(work_dir, f"{operation}.{library}.{arity}.cpp")
+    with open(path, "w") as source:
+        source.write(
+            TRANSLATION_UNIT.format(
+                operation=operation, library=library, arity=arity
+            )
+        )
+    return path
+
+
+def run_compiler(command, timeout, memory_limit_mib):
+    """Run `command` and return (exit status, wall time, peak memory in KiB).
+
+    The peak memory is the maximum resident set size of the compiler driver
+    and of the processes it spawns (e.g. cc1plus).
+    """
+
+    def limit_memory():
+        os.setsid()
+        if memory_limit_mib:
+            limit = memory_limit_mib * 1024 * 1024
+            resource.setrlimit(resource.RLIMIT_AS, (limit, limit))
+
+    start = time.perf_counter()
+    process = subprocess.Popen(
+        command,
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.PIPE,
+        preexec_fn=limit_memory,
+    )
+
+    timed_out = threading.Event()
+
+    def kill():
+        timed_out.set()
+        os.killpg(process.pid, signal.SIGKILL)
+
+    timer = threading.Timer(timeout, kill) if timeout else None
+    if timer:
+        timer.start()
+
+    # Read stderr before waiting, so that the compiler can't block on a full
+    # pipe.
+    stderr = process.stderr.read()
+    _, status, usage = os.wait4(process.pid, 0)
+    wall_time = time.perf_counter() - start
+
+    if timer:
+        timer.cancel()
+
+    # The result of `wait4` includes the waited-for children of the driver.
+    # `ru_maxrss` is in KiB on Linux and in bytes on macOS.
+    peak_kib = usage.ru_maxrss
+    if sys.platform == "darwin":
+        peak_kib //= 1024
+
+    if timed_out.is_set():
+        return "timeout", wall_time, peak_kib, stderr
+    if os.waitstatus_to_exitcode(status) != 0:
+        return "failed", wall_time, peak_kib, stderr
+    return "ok", wall_time, peak_kib, stderr
+
+
+def first_error(stderr):
+    """Return the first error reported by the compiler, if any."""
+    lines = stderr.decode(errors="replace").splitlines()
+    errors = [line for line in lines if "error" in line]
+    return (errors or lines or [""])[0].strip()
+
+
+def compiler_version(compiler):
+    try:
+        output = subprocess.run(
+            [compiler, "--version"], capture_output=True, text=True
+        ).stdout
+        return output.splitlines()[0] if output else ""
+    except OSError:
+        return ""
+
+
+def find_regressions(results, previous, threshold):
+    """List the cases whose time or memory grew by more than `threshold`."""
+    key = lambda r: (r["library"], r["operation"], r["arity"])
+    old = {key(r): r for r in previous["results"]}
+
+    regressions = []
+    for result in results:
+        before = old.get(key(result))
+        if before is None:
+            continue
+        if before["status"] == "ok" and result["status"] != "ok":
+            regressions.append((result, "status", before["status"],
+                                result["status"]))
+            continue
+        if result["status"] != "ok" or before["status"] != "ok":
+            continue
+        for metric in ("wall_time_s", "peak_memory_kib"):
+            if result[metric] > before[metric] * (1 + threshold):
+                regressions.append((result, metric, before[metric],
+                                    result[metric]))
+    return regressions
+
+
+def print_summary(results, arities, operations):
+    by_key = {(r["library"], r["operation"], r["arity"]): r for r in results}
+
+    def cell(result):
+        if result is None:
+            return "-"
+        if result["status"] != "ok":
+            return result["status"]
+        return "{:.2f}s {:.0f}M".format(
+            result["wall_time_s"], result["peak_memory_kib"] / 1024
+        )
+
+    header = "{:<16}".format("operation") + "".join(
+        "{:>30}".format(f"{arity} (tr / std)") for arity in arities
+    )
+    print(header)
+    for operation in operations:
+        row = "{:<16}".format(operation)
+        for arity in arities:
+            tr_cell = cell(by_key.get(("tr", operation, arity)))
+            std_cell = cell(by_key.get(("std", operation, arity)))
+            row += "{:>30}".format(f"{tr_cell} / {std_cell}")
+        print(row)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compiler", required=True)
+    parser.add_argument("--include-dir", action="append", default=[],
+                        help="An include directory (can be repeated)")
+    parser.add_argument("--flags", default="",
+                        help="Extra compiler flags, in a single string")
+    parser.add_argument("--work-dir", required=True,
+                        help="Where to write the translation units")
+    parser.add_argument("--output", required=True,
+                        help="The path of the JSON report")
+    parser.add_argument("--libraries", default=",".join(LIBRARIES))
+    parser.add_argument("--operations", default=",".join(OPERATIONS))
+    parser.add_argument("--arities", default=",".join(map(str, ARITIES)))
+    parser.add_argument("--timeout", type=float, default=600,
+                        help="Per-compilation timeout, in seconds (0: none)")
+    parser.add_argument("--memory-limit", type=int, default=0,
+                        help="Per-compilation address space limit, in MiB "
+                             "(0: none)")
+    parser.add_argument("--compare",
+                        help="A previous report to check for regressions")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="The relative growth reported as a regression")
+    args = parser.parse_args()
+
+    libraries = parse_list(args.libraries)
+    operations = parse_list(args.operations)
+    arities = parse_list(args.arities, int)
+
+    for library in libraries:
+        if library not in LIBRARIES:
+            parser.error(f"unknown library: {library}")
+    for operation in operations:
+        if operation not in OPERATIONS:
+            parser.error(f"unknown operation: {operation}")
+
+    os.makedirs(args.work_dir, exist_ok=True)
+    here = os.path.dirname(os.path.abspath(__file__))
+    includes = [f"-I{here}"] + [f"-I{d}" for d in args.include_dir]
+    flags = shlex.split(args.flags)
+
+    results = []
+    for arity in arities:
+        for operation in operations:
+            for library in libraries:
+                source = generate(args.work_dir, library, operation, arity)
+                command = (
+                    [args.compiler, "-std=c++17"] + includes + flags
+                    + ["-c", source, "-o", source + ".o"]
+                )
+                status, wall_time, peak_kib, stderr = run_compiler(
+                    command, args.timeout, args.memory_limit
+                )
+                result = {
+                    "library": library,
+                    "operation": operation,
+                    "arity": arity,
+                    "status": status,
+                    "wall_time_s": round(wall_time, 3),
+                    "peak_memory_kib": peak_kib,
+                }
+                if status == "failed":
+                    result["error"] = first_error(stderr)
+                results.append(result)
+
+                print(f"{operation:<16} {library:<4} {arity:>5}: {status:<8}"
+                      f"{wall_time:8.2f}s {peak_kib / 1024:8.0f}M",
+                      flush=True)
+                if status == "failed":
+                    print(f"    {result['error']}", file=sys.stderr)
+
+    report = {
+        "compiler": args.compiler,
+        "compiler_version": compiler_version(args.compiler),
+        "flags": flags,
+        "host": platform.node(),
+        "results": results,
+    }
+    with open(args.output, "w") as output:
+        json.dump(report, output, indent=2)
+        output.write("\n")
+
+    print()
+    print_summary(results, arities, operations)
+    print(f"\nReport written to {args.output}")
+
+    if args.compare:
+        with open(args.compare) as previous:
+            regressions = find_regressions(results, json.load(previous),
+                                           args.threshold)
+        for result, metric, before, after in regressions:
+            print(f"REGRESSION {result['operation']} {result['library']} "
+                  f"{result['arity']}: {metric} {before} -> {after}")
+        if regressions:
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,263 @@
+#pragma once
+
+// The operations measured by the compile-time benchmarks. Each generated
+// translation unit includes this header and instantiates exactly one
+// operation, for one library and one arity, e.g.:
+//
+//   int main() {
+//       compile_bench::fold_left(compile_bench::tr_lib{},
+//                                std::make_index_sequence<128>{});
+//   }
+//
+// Every operation has a `tr_lib` and a `std_lib` flavor. The `std_lib` flavor
+// is what I would write with `std::tuple` and `std::apply` to get the same
+// result, so that the report compares the two libraries on equal terms.
+
+#include <tr/algorithm.h>
+#include <tr/algorithm/for_each.h>
+#include <tr/at.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/unpack.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/reverse_view.h>
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace compile_bench {
+
+/// @brief The element type: each element of the tuple has a distinct type, as
+/// in real code, so the compiler can't reuse instantiations across elements.
+template <std::size_t I>
+struct elem {
+    int value;
+};
+
+struct tr_lib {
+    template <typename... Ts>
+    using tuple_t = tr::tuple<Ts...>;
+};
+
+struct std_lib {
+    template <typename... Ts>
+    using tuple_t = std::tuple<Ts...>;
+};
+
+/// @brief A value unknown at compile time.
+inline auto seed() -> int {
+    static volatile int value{1};
+    return value;
+}
+
+/// @brief Keep `value` alive until code generation.
+inline void sink(int value) {
+    static volatile int result;
+    result = value;
+}
+
+inline constexpr auto is_positive = [](auto const &e) { return e.value > 0; };
+
+template <typename Lib, std::size_t... Is>
+auto make(Lib, std::index_sequence<Is...>) {
+    using tuple_t = typename Lib::template tuple_t<elem<Is>...>;
+    return tuple_t{elem<Is>{seed()}...};
+}
+
+// -- Operations
+
+template <typename Lib, std::size_t... Is>
+void baseline(Lib, std::index_sequence<Is...>) {}
+
+template <typename Lib, std::size_t... Is>
+void construction(Lib lib, std::index_sequence<Is...> is) {
+    using std::get;
+    auto t = compile_bench::make(lib, is);
+    sink(get<0>(t).value);
+}
+
+template <typename Lib, std::size_t... Is>
+void get(Lib lib, std::index_sequence<Is...> is) {
+    using std::get;
+    using tr::get;
+    auto t = compile_bench::make(lib, is);
+    sink((get<Is>(t).value + ...));
+}
+
+template <typename Lib, std::size_t... Is>
+void swap(Lib lib, std::index_sequence<Is...> is) {
+    using std::get;
+    using std::swap;
+    auto lhs = compile_bench::make(lib, is);
+    auto rhs = compile_bench::make(lib, is);
+    swap(lhs, rhs);
+    sink(get<0>(lhs).value);
+}
+
+template <typename Lib, std::size_t... Is>
+void conversion(Lib lib, std::index_sequence<Is...> is) {
+    using std::get;
+    using tr::get;
+    auto t = compile_bench::make(lib, is);
+    typename Lib::template tuple_t<elem<Is> &...> refs{get<Is>(t)...};
+    typename Lib::template tuple_t<elem<Is>...> copy = refs;
+    sink(get<0>(copy).value);
+}
+
+template <std::size_t... Is>
+void unpack(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    sink(tr::unpack(t, [](auto const &...es) { return (es.value + ...); }));
+}
+
+template <std::size_t... Is>
+void unpack(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    sink(std::apply([](auto const &...es) { return (es.value + ...); }, t));
+}
+
+template <std::size_t... Is>
+void for_each(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    int sum{};
+    tr::for_each(t, [&sum](auto const &e) { sum += e.value; });
+    sink(sum);
+}
+
+template <std::size_t... Is>
+void for_each(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    int sum{};
+    std::apply([&sum](auto const &...es) { ((sum += es.value), ...); }, t);
+    sink(sum);
+}
+
+template <std::size_t... Is>
+void fold_left(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    sink(tr::fold_left(t, 0,
+                       [](int acc, auto const &e) { return acc + e.value; }));
+}
+
+template <std::size_t... Is>
+void fold_left(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    auto fold = [](auto const &...es) {
+        int acc{};
+        ((acc = acc + es.value), ...);
+        return acc;
+    };
+    sink(std::apply(fold, t));
+}
+
+template <std::size_t... Is>
+void fold_left_first(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    auto res = tr::fold_left_first(t, [](auto acc, auto const &e) {
+        return elem<0>{acc.value + e.value};
+    });
+    sink(res.value);
+}
+
+template <std::size_t... Is>
+void fold_left_first(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    auto fold = [](auto const &first, auto const &...es) {
+        elem<0> acc{first.value};
+        ((acc = elem<0>{acc.value + es.value}), ...);
+        return acc;
+    };
+    sink(std::apply(fold, t).value);
+}
+
+template <std::size_t... Is>
+void all_of(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    sink(tr::all_of(t, is_positive));
+}
+
+template <std::size_t... Is>
+void all_of(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    sink(std::apply(
+        [](auto const &...es) { return (is_positive(es) && ...); }, t));
+}
+
+template <std::size_t... Is>
+void count_if(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    sink(static_cast<int>(tr::count_if(t, is_positive)));
+}
+
+template <std::size_t... Is>
+void count_if(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    sink(std::apply(
+        [](auto const &...es) { return (int{is_positive(es)} + ...); }, t));
+}
+
+/// @brief Query the type of each element.
+template <typename Lib, std::size_t... Is>
+void tuple_element(Lib, std::index_sequence<Is...>) {
+    using tuple_t = typename Lib::template tuple_t<elem<Is>...>;
+    sink((static_cast<int>(sizeof(std::tuple_element_t<Is, tuple_t>)) + ...));
+}
+
+/// @brief Read each value of an index sequence.
+template <std::size_t... Is>
+void sequence_at(tr_lib, std::index_sequence<Is...> is) {
+    sink(static_cast<int>(
+        (decltype(tr::at(is, tr::zuic<Is>))::value + ... + 0)));
+}
+
+template <std::size_t... Is>
+void sequence_at(std_lib, std::index_sequence<Is...>) {
+    constexpr std::size_t values[]{Is...};
+    sink(static_cast<int>((values[Is] + ... + 0)));
+}
+
+/// @brief Drop the first element, reverse the rest and read all of them.
+template <std::size_t... Is>
+void views(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    auto view = t | tr::drop_c<1> | tr::reverse;
+    sink(tr::unpack(view, [](auto const &...es) { return (es.value + ...); }));
+}
+
+template <typename Tuple, std::size_t... Ks>
+auto reversed_tail(Tuple &t, std::index_sequence<Ks...>) {
+    constexpr std::size_t size{std::tuple_size_v<Tuple>};
+    return std::forward_as_tuple(std::get<size - 1 - Ks>(t)...);
+}
+
+template <std::size_t... Is>
+void views(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    auto view = compile_bench::reversed_tail(
+        t, std::make_index_sequence<sizeof...(Is) - 1>{});
+    sink(std::apply([](auto const &...es) { return (es.value + ...); }, view));
+}
+
+/// @brief Stack four index-permuting views and read all the elements.
+template <std::size_t... Is>
+void nested_views(tr_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    auto view = t | tr::reverse | tr::drop_c<1> | tr::reverse | tr::drop_c<1>;
+    sink(tr::unpack(view, [](auto const &...es) { return (es.value + ...); }));
+}
+
+template <typename Tuple, std::size_t... Ks>
+auto inner(Tuple &t, std::index_sequence<Ks...>) {
+    return std::forward_as_tuple(std::get<1 + Ks>(t)...);
+}
+
+template <std::size_t... Is>
+void nested_views(std_lib lib, std::index_sequence<Is...> is) {
+    auto t = compile_bench::make(lib, is);
+    auto view =
+        compile_bench::inner(t, std::make_index_sequence<sizeof...(Is) - 2>{});
+    sink(std::apply([](auto const &...es) { return (es.value + ...); }, view));
+}
+
+} // namespace compile_bench
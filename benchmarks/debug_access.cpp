@@ -0,0 +1,82 @@
+// Compare element access through `tr::get`, `tr::at`, `tr::unpack` and a chain
+// of views with the same accesses to a hand-written struct. This benchmark is
+// always built with optimizations off: it keeps the cost of the forwarding
+// layers in debug builds in check.
+
+#include "bench.h"
+
+#include <tr/at.h>
+#include <tr/tuple.h>
+#include <tr/unpack.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/reverse_view.h>
+
+#include <cstddef>
+#include <cstdio>
+
+namespace {
+
+constexpr std::size_t iteration_count{1 << 20};
+
+struct row {
+    int a;
+    int b;
+    int c;
+    int d;
+};
+
+using row_t = tr::tuple<int, int, int, int>;
+
+[[nodiscard]] auto sum_struct(row const &r) -> int {
+    return r.a + r.b + r.c + r.d;
+}
+
+[[nodiscard]] auto sum_get(row_t const &r) -> int {
+    return tr::get<0>(r) + tr::get<1>(r) + tr::get<2>(r) + tr::get<3>(r);
+}
+
+[[nodiscard]] auto sum_at(row_t const &r) -> int {
+    return tr::at_c<0>(r) + tr::at_c<1>(r) + tr::at_c<2>(r) + tr::at_c<3>(r);
+}
+
+[[nodiscard]] auto sum_unpack(row_t const &r) -> int {
+    return tr::unpack(r, [](int a, int b, int c, int d) {
+        return a + b + c + d;
+    });
+}
+
+[[nodiscard]] auto sum_views(row_t const &r) -> int {
+    auto const v = r | tr::reverse | tr::drop_c<0> | tr::reverse;
+    return tr::at_c<0>(v) + tr::at_c<1>(v) + tr::at_c<2>(v) + tr::at_c<3>(v);
+}
+
+template <typename Row, typename Sum>
+auto run(char const *name, Row const &r, Sum sum, double baselineNs = -1)
+    -> double {
+    auto const ns = bench::measure_ns([&] {
+        int total{};
+        for (std::size_t i{}; i != iteration_count; ++i) {
+            bench::do_not_optimize(r);
+            total += sum(r);
+        }
+        bench::do_not_optimize(total);
+    });
+    bench::report(name, ns, iteration_count, iteration_count * sizeof(Row));
+    if (baselineNs > 0) {
+        std::printf("%-40s %10.2fx\n", "  slowdown vs struct", ns / baselineNs);
+    }
+    return ns;
+}
+
+} // namespace
+
+int main() {
+    row const r{1, 2, 3, 4};
+    row_t const t{1, 2, 3, 4};
+
+    auto const baselineNs = run("struct: 4 members", r, sum_struct);
+    run("tr::get: 4 elements", t, sum_get, baselineNs);
+    run("tr::at_c: 4 elements", t, sum_at, baselineNs);
+    run("tr::unpack: 4 elements", t, sum_unpack, baselineNs);
+    run("tr::at_c: 3 nested views", t, sum_views, baselineNs);
+}
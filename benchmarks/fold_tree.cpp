@@ -0,0 +1,99 @@
+// Compare `tr::fold_tree` with `tr::fold_left` when reducing a sequence of
+// tuples of `double`s into a running accumulator: a left fold is a single
+// chain of dependent operations, whereas the tree only has O(log(N)) of them
+// between two consecutive values of the accumulator.
+
+#include "bench.h"
+
+#include <tr/algorithm/fold_left.h>
+#include <tr/algorithm/fold_tree.h>
+#include <tr/tuple.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count{1 << 16};
+
+template <std::size_t I>
+using double_t = double;
+
+template <typename IdxPack>
+struct lanes;
+
+template <std::size_t... Is>
+struct lanes<std::index_sequence<Is...>> {
+    using type = tr::tuple<double_t<Is>...>;
+
+    [[nodiscard]] static auto make(std::size_t seed) -> type {
+        return type{static_cast<double>((seed * 31 + Is * 7) % 101)...};
+    }
+};
+
+struct plus {
+    auto operator()(double x, double y) const noexcept -> double {
+        return x + y;
+    }
+};
+
+struct min {
+    auto operator()(double x, double y) const noexcept -> double {
+        return y < x ? y : x;
+    }
+};
+
+struct max {
+    auto operator()(double x, double y) const noexcept -> double {
+        return x < y ? y : x;
+    }
+};
+
+template <std::size_t N, typename Op>
+void run(char const *leftName, char const *treeName, Op op) {
+    using tuple_t = typename lanes<std::make_index_sequence<N>>::type;
+
+    std::vector<tuple_t> tuples;
+    tuples.reserve(element_count / N);
+    for (std::size_t i{}; i != element_count / N; ++i) {
+        tuples.push_back(lanes<std::make_index_sequence<N>>::make(i));
+    }
+
+    auto const leftNs = bench::measure_ns([&] {
+        double res{};
+        for (auto const &t : tuples) {
+            res = tr::fold_left(t, res, op);
+        }
+        bench::do_not_optimize(res);
+    });
+    bench::report(leftName, leftNs, element_count,
+                  element_count * sizeof(double));
+
+    auto const treeNs = bench::measure_ns([&] {
+        double res{};
+        for (auto const &t : tuples) {
+            res = tr::fold_tree(t, res, op);
+        }
+        bench::do_not_optimize(res);
+    });
+    bench::report(treeName, treeNs, element_count,
+                  element_count * sizeof(double));
+}
+
+} // namespace
+
+int main() {
+    run<16>("fold_left: sum of 16 doubles", "fold_tree: sum of 16 doubles",
+            plus{});
+    run<64>("fold_left: sum of 64 doubles", "fold_tree: sum of 64 doubles",
+            plus{});
+    run<16>("fold_left: min of 16 doubles", "fold_tree: min of 16 doubles",
+            min{});
+    run<64>("fold_left: min of 64 doubles", "fold_tree: min of 64 doubles",
+            min{});
+    run<16>("fold_left: max of 16 doubles", "fold_tree: max of 16 doubles",
+            max{});
+    run<64>("fold_left: max of 64 doubles", "fold_tree: max of 64 doubles",
+            max{});
+}
@@ -0,0 +1,125 @@
+// Measure `tr::hash` on tuple keys, against a hand-written `std::hash`
+// specialization combining the fields with `boost::hash_combine`'s formula:
+//  * the throughput of hashing keys one at a time and with `tr::hash_batch`,
+//    for keys hashed as bytes (no padding) and field by field (padding);
+//  * the quality of the hashes, as the number of collisions among the low
+//    20 bits of the hashes of 2^20 grid coordinates, and the number of keys
+//    probed by an `std::unordered_set` lookup.
+
+#include "bench.h"
+
+#include <tr/algorithm/for_each.h>
+#include <tr/hash.h>
+#include <tr/tuple.h>
+#include <tr/unpack.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t key_count{1 << 12};
+
+using packed_t = tr::tuple<std::uint32_t, std::uint32_t, std::uint64_t>;
+using padded_t = tr::tuple<std::uint16_t, std::uint64_t, std::uint32_t>;
+
+struct combine_hash {
+    template <typename Tuple>
+    auto operator()(Tuple const &t) const noexcept -> std::size_t {
+        std::size_t seed{};
+        tr::unpack(t, [&seed](auto const &...elems) {
+            ((seed ^= std::hash<std::remove_cv_t<
+                          std::remove_reference_t<decltype(elems)>>>{}(elems) +
+                      0x9e3779b9 + (seed << 6) + (seed >> 2)),
+             ...);
+        });
+        return seed;
+    }
+};
+
+template <typename Key>
+[[nodiscard]] auto make_keys() -> std::vector<Key> {
+    std::vector<Key> keys(key_count);
+    for (std::size_t i{}; i != key_count; ++i) {
+        std::size_t value{i};
+        tr::for_each(keys[i], [&value](auto &field) {
+            field = static_cast<std::remove_reference_t<decltype(field)>>(
+                value);
+            value *= 0x9e3779b1;
+        });
+    }
+    return keys;
+}
+
+template <typename Key>
+void throughput(std::string const &suffix) {
+    auto const keys = make_keys<Key>();
+    std::vector<std::size_t> hashes(key_count);
+
+    auto const report = [&](std::string const &name, auto &&func) {
+        auto const ns = bench::measure_ns([&] {
+            func();
+            bench::do_not_optimize(hashes.data());
+        });
+        bench::report((name + suffix).c_str(), ns, key_count,
+                      key_count * sizeof(Key));
+    };
+
+    report("hash_combine:   ", [&] {
+        for (std::size_t i{}; i != key_count; ++i) {
+            hashes[i] = combine_hash{}(keys[i]);
+        }
+    });
+    report("tr::hash:       ", [&] {
+        for (std::size_t i{}; i != key_count; ++i) {
+            hashes[i] = tr::hash<Key>{}(keys[i]);
+        }
+    });
+    report("tr::hash_batch: ", [&] {
+        tr::hash_batch(keys.data(), key_count, hashes.data());
+    });
+}
+
+template <typename Hash>
+void quality(char const *name) {
+    using key_t = tr::tuple<std::int32_t, std::int32_t>;
+    constexpr std::size_t side{1 << 10};
+    constexpr std::size_t mask{(1 << 20) - 1};
+
+    std::vector<unsigned char> buckets(mask + 1);
+    std::size_t collisions{};
+    std::unordered_set<key_t, Hash> set;
+    set.reserve(side * side);
+    for (std::size_t x{}; x != side; ++x) {
+        for (std::size_t y{}; y != side; ++y) {
+            key_t const key{static_cast<std::int32_t>(x),
+                            static_cast<std::int32_t>(y)};
+            collisions += buckets[Hash{}(key)&mask]++ != 0;
+            set.insert(key);
+        }
+    }
+
+    std::size_t probes{};
+    for (std::size_t b{}; b != set.bucket_count(); ++b) {
+        auto const size = set.bucket_size(b);
+        probes += size * (size + 1) / 2;
+    }
+    std::printf("%-40s %10zu collisions %6.3f probes/lookup\n", name,
+                collisions,
+                static_cast<double>(probes) / static_cast<double>(set.size()));
+}
+
+} // namespace
+
+int main() {
+    throughput<packed_t>("(bytes)");
+    throughput<padded_t>("(fields)");
+
+    quality<combine_hash>("hash_combine: 1024x1024 grid");
+    quality<tr::hash<>>("tr::hash:     1024x1024 grid");
+}
@@ -0,0 +1,99 @@
+// Compare loading a file of 2^21 records into a `std::vector` (read, then
+// `deserialize` each record) with mapping it as a `tr::record_file`, and
+// scanning one element of each record through the lazy `record_view`s, with
+// the `rows` and the `columns` layouts. Opening the file is reported as a
+// single item. The file is in the page cache: the timings are those of a warm
+// start.
+
+#include "bench.h"
+
+#include <tr/at.h>
+#include <tr/record_file.h>
+#include <tr/serialize.h>
+#include <tr/tuple.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t record_count{1 << 21};
+
+using row_t = tr::tuple<std::int64_t, double, float, std::uint32_t>;
+
+constexpr std::size_t row_size{tr::serialized_size_v<row_t>};
+
+[[nodiscard]] auto temp_path(char const *name) -> std::string {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+template <tr::record_layout Layout>
+void scan(char const *openName, char const *scanName,
+          std::string const &path) {
+    auto const openNs = bench::measure_ns([&] {
+        tr::record_file<row_t, Layout> file{path};
+        bench::do_not_optimize(file.size());
+    });
+    bench::report(openName, openNs, 1, record_count * row_size);
+
+    tr::record_file<row_t, Layout> file{path};
+    auto const scanNs = bench::measure_ns([&] {
+        double sum{};
+        for (auto row : file) {
+            sum += tr::at_c<1>(row);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report(scanName, scanNs, record_count,
+                  record_count * sizeof(double));
+}
+
+} // namespace
+
+int main() {
+    std::vector<row_t> rows;
+    rows.reserve(record_count);
+    for (std::size_t i{}; i != record_count; ++i) {
+        rows.push_back(row_t{static_cast<std::int64_t>(i), i * 0.5,
+                             static_cast<float>(i % 101),
+                             static_cast<std::uint32_t>(i * 31)});
+    }
+
+    auto const rowsPath = temp_path("tr_bench_rows.rec");
+    auto const columnsPath = temp_path("tr_bench_columns.rec");
+    tr::write_record_file(rowsPath, rows);
+    tr::write_record_file<tr::record_layout::columns>(columnsPath, rows);
+
+    auto const loadNs = bench::measure_ns([&] {
+        std::ifstream in{rowsPath, std::ios::binary | std::ios::ate};
+        std::vector<std::byte> bytes(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(reinterpret_cast<char *>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size()));
+
+        std::vector<row_t> loaded(record_count);
+        std::byte const *src = bytes.data() + 64;
+        for (auto &row : loaded) {
+            row = tr::deserialize<row_t>(src);
+            src += row_size;
+        }
+        bench::do_not_optimize(loaded.data());
+    });
+    bench::report("read + deserialize into a vector", loadNs, record_count,
+                  record_count * row_size);
+
+    scan<tr::record_layout::rows>("record_file<rows>: open",
+                                  "record_file<rows>: scan one element",
+                                  rowsPath);
+    scan<tr::record_layout::columns>("record_file<columns>: open",
+                                     "record_file<columns>: scan one element",
+                                     columnsPath);
+
+    std::remove(rowsPath.c_str());
+    std::remove(columnsPath.c_str());
+}
@@ -0,0 +1,88 @@
+// Compare `tr::serialize` and `tr::deserialize` with writing the fields of
+// each record to a `std::ostringstream` (in binary, through `write`), over
+// records whose layout is their serialized form (a single `memcpy`) and
+// records with padding (field by field).
+
+#include "bench.h"
+
+#include <tr/algorithm/for_each.h>
+#include <tr/serialize.h>
+#include <tr/tuple.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t record_count{1 << 16};
+
+using packed_t = tr::tuple<std::uint64_t, double, double, std::int32_t,
+                           std::int32_t>;
+using padded_t = tr::tuple<std::uint8_t, double, std::int32_t, std::uint16_t,
+                           double>;
+
+template <typename Record>
+[[nodiscard]] auto make_records() -> std::vector<Record> {
+    std::vector<Record> records(record_count);
+    for (std::size_t i{}; i != record_count; ++i) {
+        tr::for_each(records[i], [i](auto &field) {
+            using field_t = std::remove_reference_t<decltype(field)>;
+            field = static_cast<field_t>(i * 31 % 101);
+        });
+    }
+    return records;
+}
+
+template <typename Record>
+void run(std::string const &suffix) {
+    constexpr std::size_t size{tr::serialized_size_v<Record>};
+    constexpr std::size_t bytes{record_count * size};
+
+    auto const records = make_records<Record>();
+    std::vector<std::byte> buf(bytes);
+
+    auto const streamNs = bench::measure_ns([&] {
+        std::ostringstream out;
+        for (auto const &record : records) {
+            tr::for_each(record, [&out](auto const &field) {
+                out.write(reinterpret_cast<char const *>(&field),
+                          sizeof(field));
+            });
+        }
+        bench::do_not_optimize(out.str().size());
+    });
+    bench::report(("ostringstream: " + suffix).c_str(), streamNs,
+                  record_count, bytes);
+
+    auto const serializeNs = bench::measure_ns([&] {
+        std::byte *out = buf.data();
+        for (auto const &record : records) {
+            out = tr::serialize(out, record);
+        }
+        bench::do_not_optimize(buf.data());
+    });
+    bench::report(("serialize:     " + suffix).c_str(), serializeNs,
+                  record_count, bytes);
+
+    std::vector<Record> copies(record_count);
+    auto const deserializeNs = bench::measure_ns([&] {
+        std::byte const *in = buf.data();
+        for (auto &copy : copies) {
+            copy = tr::deserialize<Record>(in);
+            in += size;
+        }
+        bench::do_not_optimize(copies.data());
+    });
+    bench::report(("deserialize:   " + suffix).c_str(), deserializeNs,
+                  record_count, bytes);
+}
+
+} // namespace
+
+int main() {
+    run<packed_t>("packed (memcpy)");
+    run<padded_t>("padded (field-wise)");
+}
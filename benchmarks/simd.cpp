@@ -0,0 +1,86 @@
+// Compare the generic path of `fold_left` and `all_of` with their SIMD kernels
+// (taken for `lanewise` callables), over tuples of 16 and 64 `int`s and
+// `float`s.
+
+#include "bench.h"
+
+#include <tr/algorithm/all_of.h>
+#include <tr/algorithm/fold_left.h>
+#include <tr/simd.h>
+#include <tr/tuple.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count{1 << 16};
+
+template <typename T, std::size_t I>
+using lane_t = T;
+
+template <typename T, typename IdxPack>
+struct lanes;
+
+template <typename T, std::size_t... Is>
+struct lanes<T, std::index_sequence<Is...>> {
+    using type = tr::tuple<lane_t<T, Is>...>;
+
+    [[nodiscard]] static auto make(std::size_t seed) -> type {
+        return type{static_cast<T>((seed * 31 + Is * 7) % 101)...};
+    }
+};
+
+template <typename T, std::size_t N, typename Kernel>
+void run(std::string const &name, Kernel kernel) {
+    using tuple_t = typename lanes<T, std::make_index_sequence<N>>::type;
+
+    std::vector<tuple_t> tuples;
+    tuples.reserve(element_count / N);
+    for (std::size_t i{}; i != element_count / N; ++i) {
+        tuples.push_back(lanes<T, std::make_index_sequence<N>>::make(i));
+    }
+
+    auto const ns = bench::measure_ns([&] {
+        for (auto &t : tuples) {
+            kernel(t);
+        }
+        bench::do_not_optimize(tuples.data());
+    });
+    bench::report(name.c_str(), ns, element_count,
+                  element_count * sizeof(T));
+}
+
+template <typename T, std::size_t N>
+void run_all(std::string const &suffix) {
+    auto const plus = [](T x, T y) -> T { return x + y; };
+    auto const nonNegative = [](T x) { return x >= 0; };
+
+    T sum{};
+    run<T, N>("generic:  fold_left " + suffix,
+              [&](auto const &t) { sum += tr::fold_left(t, T{}, plus); });
+    run<T, N>("lanewise: fold_left " + suffix, [&](auto const &t) {
+        sum += tr::fold_left(t, T{}, tr::lanewise(std::plus<>{}));
+    });
+    bench::do_not_optimize(sum);
+
+    bool all{true};
+    run<T, N>("generic:  all_of    " + suffix,
+              [&](auto const &t) { all &= tr::all_of(t, nonNegative); });
+    run<T, N>("lanewise: all_of    " + suffix, [&](auto const &t) {
+        all &= tr::all_of(t, tr::lanewise([](auto x) { return x >= 0; }));
+    });
+    bench::do_not_optimize(all);
+}
+
+} // namespace
+
+int main() {
+    run_all<int, 16>("(16 ints)");
+    run_all<int, 64>("(64 ints)");
+    run_all<float, 16>("(16 floats)");
+    run_all<float, 64>("(64 floats)");
+}
@@ -0,0 +1,72 @@
+// Compare a single-column scan over a `tr::soa_vector` with the same scan
+// over a `std::vector<tr::tuple<...>>` (i.e. an array of structs).
+
+#include "bench.h"
+
+#include <tr/soa_vector.h>
+#include <tr/tuple.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace tr::literals;
+
+namespace {
+
+using row_t = tr::tuple<int, float, float, std::uint8_t>;
+constexpr std::size_t row_count{1 << 22};
+
+template <typename Column>
+[[nodiscard]] auto sum_column(Column const &column) -> float {
+    float sum{};
+    for (float x : column) {
+        sum += x;
+    }
+    return sum;
+}
+
+[[nodiscard]] auto sum_rows(std::vector<row_t> const &rows) -> float {
+    float sum{};
+    for (auto const &row : rows) {
+        sum += row[1_zuic];
+    }
+    return sum;
+}
+
+} // namespace
+
+int main() {
+    tr::soa_vector<int, float, float, std::uint8_t> soa;
+    std::vector<row_t> aos;
+
+    soa.reserve(row_count);
+    aos.reserve(row_count);
+    for (std::size_t i{}; i != row_count; ++i) {
+        auto const f = static_cast<float>(i % 7);
+        soa.emplace_back(static_cast<int>(i), f, -f, std::uint8_t(i));
+        aos.push_back(row_t{static_cast<int>(i), f, -f, std::uint8_t(i)});
+    }
+
+    auto const columnBytes = row_count * sizeof(float);
+
+    auto const soaNs = bench::measure_ns(
+        [&] { bench::do_not_optimize(sum_column(soa.column(1_zuic))); });
+    bench::report("soa_vector: scan one float column", soaNs, row_count,
+                  columnBytes);
+
+    auto const soaRowsNs = bench::measure_ns([&] {
+        float sum{};
+        for (auto row : soa) {
+            sum += row[1_zuic];
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report("soa_vector: scan one field via rows", soaRowsNs, row_count,
+                  columnBytes);
+
+    auto const aosNs =
+        bench::measure_ns([&] { bench::do_not_optimize(sum_rows(aos)); });
+    bench::report("vector<tuple>: scan one float field", aosNs, row_count,
+                  row_count * sizeof(row_t));
+}
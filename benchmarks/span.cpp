@@ -0,0 +1,63 @@
+// Compare two ways of calling a function taking 8 scalar arguments on each
+// 8-element window of a large buffer: copying the window into a `tr::tuple`
+// first, and unpacking a `tr::span` over the buffer in place.
+
+#include "bench.h"
+
+#include <tr/span.h>
+#include <tr/tuple.h>
+#include <tr/unpack.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count{1 << 16};
+constexpr std::size_t window_size{8};
+
+using window_tuple_t =
+    tr::tuple<float, float, float, float, float, float, float, float>;
+
+struct filter {
+    auto operator()(float x0, float x1, float x2, float x3, float x4, float x5,
+                    float x6, float x7) const noexcept -> float {
+        return 0.02f * (x0 + x7) + 0.08f * (x1 + x6) + 0.15f * (x2 + x5) +
+               0.25f * (x3 + x4);
+    }
+};
+
+[[nodiscard]] auto copy_window(float const *data) -> window_tuple_t {
+    return {data[0], data[1], data[2], data[3],
+            data[4], data[5], data[6], data[7]};
+}
+
+template <typename Kernel>
+void run(char const *name, std::vector<float> const &in,
+         std::vector<float> &out, Kernel kernel) {
+    std::size_t const windows{in.size() - window_size + 1};
+    auto const ns = bench::measure_ns([&] {
+        for (std::size_t i{}; i != windows; ++i) {
+            out[i] = kernel(in.data() + i);
+        }
+        bench::do_not_optimize(out.data());
+    });
+    bench::report(name, ns, windows, windows * sizeof(float));
+}
+
+} // namespace
+
+int main() {
+    std::vector<float> in(element_count);
+    for (std::size_t i{}; i != in.size(); ++i) {
+        in[i] = static_cast<float>((i * 31) % 101);
+    }
+    std::vector<float> out(element_count);
+
+    run("tuple copy: 8-tap filter", in, out, [](float const *data) {
+        return tr::unpack(copy_window(data), filter{});
+    });
+    run("span: 8-tap filter", in, out, [](float const *data) {
+        return tr::unpack(tr::span<float const, window_size>{data}, filter{});
+    });
+}
@@ -0,0 +1,89 @@
+// Check that common pipelines of views don't copy the tuples they're applied
+// to: views over l-values and borrowed views (`tr::ref`) only hold a
+// reference, views over r-values move them (once per view of the chain). Each
+// row holds three 256-byte payloads, which count how many times they're copied
+// and moved.
+
+#include "bench.h"
+
+#include <tr/at.h>
+#include <tr/tuple.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/ref_view.h>
+#include <tr/view/reverse_view.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count{1 << 14};
+
+std::size_t copies{};
+std::size_t moves{};
+
+struct payload {
+    std::array<double, 32> data{};
+
+    payload() = default;
+
+    explicit payload(double v) noexcept { data.fill(v); }
+
+    payload(payload const &other) noexcept : data{other.data} { ++copies; }
+
+    payload(payload &&other) noexcept : data{other.data} { ++moves; }
+
+    auto operator=(payload const &) -> payload & = delete;
+    auto operator=(payload &&) -> payload & = delete;
+};
+
+using row_t = tr::tuple<payload, payload, payload>;
+
+template <typename View>
+[[nodiscard]] auto sum(View const &view) -> double {
+    return tr::at_c<0>(view).data[0] + tr::at_c<1>(view).data[31];
+}
+
+template <typename Pipeline>
+void run(char const *name, std::vector<row_t> &rows, Pipeline pipeline) {
+    copies = 0;
+    moves = 0;
+
+    std::size_t runs{};
+    double res{};
+    auto const ns = bench::measure_ns([&] {
+        for (auto &row : rows) {
+            res += pipeline(row);
+        }
+        bench::do_not_optimize(res);
+        ++runs;
+    });
+    bench::report(name, ns, rows.size(), rows.size() * sizeof(row_t));
+    std::printf("  copies, moves per row %18zu, %zu\n",
+                copies / (runs * rows.size()), moves / (runs * rows.size()));
+}
+
+} // namespace
+
+int main() {
+    std::vector<row_t> rows;
+    rows.reserve(element_count);
+    for (std::size_t i{}; i != element_count; ++i) {
+        auto const v = static_cast<double>(i % 101);
+        rows.push_back(row_t{payload{v}, payload{v + 1}, payload{v + 2}});
+    }
+    copies = 0;
+    moves = 0;
+
+    run("l-value: reverse | drop | reverse", rows, [](row_t &row) {
+        return sum(row | tr::reverse | tr::drop_c<1> | tr::reverse);
+    });
+    run("ref: reverse | drop | reverse", rows, [](row_t &row) {
+        return sum(tr::ref(row) | tr::reverse | tr::drop_c<1> | tr::reverse);
+    });
+    run("r-value: reverse | drop | reverse", rows, [](row_t &row) {
+        return sum(row_t{row} | tr::reverse | tr::drop_c<1> | tr::reverse);
+    });
+}
@@ -0,0 +1,117 @@
+// Compare `tr::visit_at` with a chain of `if`s on the index and with
+// `std::visit` over a variant with the same alternatives, for a small tuple
+// (dispatched through a `switch`) and a large one (dispatched through a table
+// of function pointers).
+
+#include "bench.h"
+
+#include <tr/at.h>
+#include <tr/tuple.h>
+#include <tr/visit_at.h>
+
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t query_count{1 << 20};
+
+template <std::size_t I>
+struct field {
+    int value;
+};
+
+struct read_field {
+    template <std::size_t I>
+    auto operator()(field<I> const &f) const noexcept -> int {
+        return f.value;
+    }
+};
+
+template <typename IdxPack>
+struct fields;
+
+template <std::size_t... Is>
+struct fields<std::index_sequence<Is...>> {
+    using tuple_t = tr::tuple<field<Is>...>;
+    using variant_t = std::variant<field<Is>...>;
+
+    [[nodiscard]] static auto make_tuple() -> tuple_t {
+        return tuple_t{field<Is>{static_cast<int>(Is)}...};
+    }
+
+    [[nodiscard]] static auto make_variant(std::size_t i) -> variant_t {
+        variant_t const alternatives[]{
+            variant_t{std::in_place_index<Is>,
+                      field<Is>{static_cast<int>(Is)}}...};
+        return alternatives[i];
+    }
+
+    [[nodiscard]] static auto if_chain(tuple_t const &t, std::size_t i)
+        -> int {
+        int res{};
+        (void)((i == Is ? (res = read_field{}(tr::at_c<Is>(t)), true)
+                        : false) ||
+               ...);
+        return res;
+    }
+};
+
+template <std::size_t N>
+void run(char const *ifName, char const *visitName, char const *variantName) {
+    using fields_t = fields<std::make_index_sequence<N>>;
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> dist{0, N - 1};
+
+    std::vector<std::size_t> indices(query_count);
+    std::vector<typename fields_t::variant_t> variants;
+    variants.reserve(query_count);
+    for (auto &i : indices) {
+        i = dist(gen);
+        variants.push_back(fields_t::make_variant(i));
+    }
+
+    auto const t = fields_t::make_tuple();
+    auto const bytes = query_count * sizeof(std::size_t);
+
+    auto const ifNs = bench::measure_ns([&] {
+        int sum{};
+        for (auto i : indices) {
+            sum += fields_t::if_chain(t, i);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report(ifName, ifNs, query_count, bytes);
+
+    auto const visitNs = bench::measure_ns([&] {
+        int sum{};
+        for (auto i : indices) {
+            sum += tr::visit_at(t, i, read_field{});
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report(visitName, visitNs, query_count, bytes);
+
+    auto const variantNs = bench::measure_ns([&] {
+        int sum{};
+        for (auto const &v : variants) {
+            sum += std::visit(read_field{}, v);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report(variantName, variantNs, query_count,
+                  query_count * sizeof(typename fields_t::variant_t));
+}
+
+} // namespace
+
+int main() {
+    run<4>("if chain: 4 elements", "visit_at: 4 elements",
+           "std::visit: 4 alternatives");
+    run<64>("if chain: 64 elements", "visit_at: 64 elements",
+            "std::visit: 64 alternatives");
+}
@@ -4,7 +4,10 @@
 #include <tr/algorithm/any_of.h>
 #include <tr/algorithm/fold_left.h>
 #include <tr/algorithm/fold_left_first.h>
+#include <tr/algorithm/fold_left_while.h>
+#include <tr/algorithm/fold_tree.h>
 #include <tr/algorithm/for_each.h>
+#include <tr/algorithm/for_each_while.h>
 
 #include <tr/detail/type_traits.h>
 #include <tr/tuple_protocol.h>
@@ -2,6 +2,7 @@
 
 #include <tr/algorithm/fwd/all_of.h>
 
+#include <tr/detail/simd.h>
 #include <tr/detail/type_traits.h>
 #include <tr/invoke.h>
 #include <tr/unpack.h>
@@ -14,6 +15,13 @@ struct all_of_impl<T, std::enable_if_t<is_implemented_v<unpack_impl<T>>>> {
     template <typename Tuple, typename Predicate>
     static constexpr auto apply(Tuple &&tuple, Predicate &&predicate) {
 
+        if constexpr (detail::is_simd_callable_v<
+                          T, detail::remove_cvref_t<Predicate>>) {
+            if (!detail::is_constant_evaluated()) {
+                return detail::simd_test_tuple<true>(tuple, predicate);
+            }
+        }
+
         auto andElems = [&predicate](auto &&...elems) {
             return (invoke(static_cast<Predicate &&>(predicate),
                            static_cast<decltype(elems)>(elems)) &&
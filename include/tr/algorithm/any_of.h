@@ -1,5 +1,6 @@
 #include <tr/algorithm/fwd/any_of.h>
 
+#include <tr/detail/simd.h>
 #include <tr/detail/type_traits.h>
 #include <tr/invoke.h>
 #include <tr/unpack.h>
@@ -13,6 +14,13 @@ struct any_of_impl<T, std::enable_if_t<tr::is_implemented_v<unpack_impl<T>>>> {
     static constexpr auto apply(Tuple &&tuple, Predicate &&predicate)
         -> decltype(auto) {
 
+        if constexpr (detail::is_simd_callable_v<
+                          T, detail::remove_cvref_t<Predicate>>) {
+            if (!detail::is_constant_evaluated()) {
+                return detail::simd_test_tuple<false>(tuple, predicate);
+            }
+        }
+
         auto orElems = [&predicate](auto &&...elems) {
             return (invoke(static_cast<Predicate &&>(predicate),
                            static_cast<decltype(elems)>(elems)) ||
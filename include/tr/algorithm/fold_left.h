@@ -3,11 +3,89 @@
 #include <tr/algorithm/fwd/fold_left.h>
 
 #include <tr/combinator.h>
+#include <tr/detail/simd.h>
 #include <tr/detail/utility.h>
+#include <tr/invoke.h>
 #include <tr/unpack.h>
 
+#include <type_traits>
+#include <utility>
+
 namespace tr {
 
+namespace detail {
+
+/// @brief Get the callable to invoke at each step of a flat fold: I call
+/// class types directly, as going through `invoke` at each step has a
+/// noticeable compile-time cost; anything else (e.g. pointers to members) is
+/// wrapped once.
+template <typename Combinator>
+constexpr auto fold_op_for(Combinator &c) noexcept -> decltype(auto) {
+    if constexpr (std::is_class_v<Combinator>) {
+        return c;
+    } else {
+        return detail::invoke_wrapper_for(c);
+    }
+}
+
+template <typename Op, typename Acc, typename Elem, typename = void>
+static constexpr bool keeps_accumulator_v{false};
+
+/// @brief Check if `Op` may be called on an `Acc` and an `Elem`, and yields an
+/// `Acc`. Steps which can't be called (as the accumulator of a non-flat fold
+/// changes type along the way) are `false`, rather than a hard error.
+template <typename Op, typename Acc, typename Elem>
+static constexpr bool keeps_accumulator_v<
+    Op, Acc, Elem, std::enable_if_t<std::is_invocable_v<Op &, Acc, Elem>>>{
+    std::is_same_v<std::invoke_result_t<Op &, Acc, Elem>, Acc>};
+
+/// @brief Check if folding `Elems...` onto an accumulator of type `Acc` keeps
+/// the accumulator type, so that it can be updated in place.
+template <typename Op, typename Acc, typename... Elems>
+static constexpr bool is_flat_foldable_v{
+    std::is_object_v<Acc> && !std::is_const_v<Acc> &&
+    std::is_move_assignable_v<Acc> &&
+    (keeps_accumulator_v<Op, Acc, Elems> && ...)};
+
+template <typename Combinator, typename Init>
+constexpr auto fold_left_flat(Combinator &&, Init &&init) -> Init {
+    return static_cast<Init &&>(init);
+}
+
+/// @brief Fold `first, rest...` onto `init`.
+///
+/// @details If the first step yields a value of type `Acc` and each of the
+/// following steps yields an `Acc` too (e.g. a sum of `int`s), the fold
+/// updates a single `Acc` in place. This is O(1) in the number of elements in
+/// terms of instantiated class templates. Otherwise (e.g. the result of each
+/// step has a different type, or it's a reference), each step goes through a
+/// `combinator` holding the result of the previous step.
+template <typename Combinator, typename Init, typename First,
+          typename... Rest>
+constexpr auto fold_left_flat(Combinator &&c, Init &&init, First &&first,
+                              Rest &&...rest) -> decltype(auto) {
+
+    auto &&op = detail::fold_op_for(c);
+    using op_t = decltype(op);
+    using acc_t =
+        decltype(op(static_cast<Init &&>(init), static_cast<First &&>(first)));
+
+    if constexpr (is_flat_foldable_v<op_t, acc_t, Rest &&...>) {
+        acc_t acc(op(static_cast<Init &&>(init), static_cast<First &&>(first)));
+        ((acc = op(std::move(acc), static_cast<Rest &&>(rest))), ...);
+        return acc;
+    } else {
+        combinator comb{static_cast<Combinator &&>(c),
+                        static_cast<Init &&>(init)};
+
+        auto foldExpr = ((std::move(comb) | static_cast<First &&>(first)) |
+                         ... | static_cast<Rest &&>(rest));
+        return detail::lref_or_value(std::move(foldExpr).value());
+    }
+}
+
+} // namespace detail
+
 template <typename T>
 struct fold_left_impl<T, std::enable_if_t<is_implemented_v<unpack_impl<T>>>> {
 
@@ -15,13 +93,17 @@ struct fold_left_impl<T, std::enable_if_t<is_implemented_v<unpack_impl<T>>>> {
     static constexpr auto apply(Tuple &&tuple, Init &&init, Combinator &&c)
         -> decltype(auto) {
 
-        auto fold = [&](auto &&...elems) -> decltype(auto) {
-            combinator comb{static_cast<Combinator &&>(c),
-                            static_cast<Init &&>(init)};
+        if constexpr (detail::is_simd_foldable_v<
+                          T, Init, detail::remove_cvref_t<Combinator>>) {
+            if (!detail::is_constant_evaluated()) {
+                return detail::simd_fold_left(tuple, init, c);
+            }
+        }
 
-            auto foldExpr =
-                (std::move(comb) | ... | static_cast<decltype(elems)>(elems));
-            return detail::lref_or_value(std::move(foldExpr).value());
+        auto fold = [&](auto &&...elems) -> decltype(auto) {
+            return detail::fold_left_flat(
+                static_cast<Combinator &&>(c), static_cast<Init &&>(init),
+                static_cast<decltype(elems)>(elems)...);
         };
 
         return unpack(static_cast<Tuple &&>(tuple), fold);
@@ -39,4 +121,4 @@ template <typename Tuple, typename Init, typename Combinator>
                                           static_cast<Combinator &&>(c));
 }
 
-} // namespace tr
\ No newline at end of file
+} // namespace tr
@@ -2,6 +2,7 @@
 
 #include <tr/algorithm/fwd/fold_left_first.h>
 
+#include <tr/algorithm/fold_left.h>
 #include <tr/at.h>
 #include <tr/detail/utility.h>
 #include <tr/indices_for.h>
@@ -20,13 +21,9 @@ struct fold_left_first_impl<std::index_sequence<0, Is...>> {
     template <typename Tuple, typename Combinator>
     static constexpr auto apply(Tuple &&t, Combinator &&c) -> decltype(auto) {
 
-        auto &&init = at_c<0>(static_cast<Tuple &&>(t));
-        combinator comb{static_cast<Combinator &&>(c),
-                        static_cast<decltype(init)>(init)};
-
-        auto foldExpr =
-            (std::move(comb) | ... | at_c<Is>(static_cast<Tuple &&>(t)));
-        return detail::lref_or_value(std::move(foldExpr).value());
+        return detail::fold_left_flat(static_cast<Combinator &&>(c),
+                                      at_c<0>(static_cast<Tuple &&>(t)),
+                                      at_c<Is>(static_cast<Tuple &&>(t))...);
     }
 };
 
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <tr/algorithm/fwd/fold_left_while.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/invoke.h>
+#include <tr/length.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief Fold the elements of `tuple` from the `I`-th one onto `acc`, until
+/// a step yields a falsy accumulator, with a short-circuiting fold which
+/// updates `acc` in place.
+template <std::size_t I, typename Tuple, typename Combinator, typename Acc,
+          std::size_t... Is>
+constexpr auto fold_left_while_fold(Tuple &&tuple, Combinator &c, Acc acc,
+                                    std::index_sequence<Is...>) -> Acc {
+    static_assert(
+        (std::is_same_v<decltype(tr::invoke(
+                            c, std::declval<Acc>(),
+                            at_c<I + Is>(static_cast<Tuple &&>(tuple)))),
+                        Acc> &&
+         ...),
+        "fold_left_while requires all the steps to yield the same type, "
+        "unless it's a compile-time boolean");
+
+    (static_cast<bool>((acc = tr::invoke(
+                            c, std::move(acc),
+                            at_c<I + Is>(static_cast<Tuple &&>(tuple))))) &&
+     ...);
+    return acc;
+}
+
+/// @brief Fold the elements of `tuple` from the `I`-th one onto `acc`, until
+/// a step yields a falsy accumulator.
+///
+/// @details If a step yields a compile-time `false` (e.g.
+/// `value_constant<false>`), `c` is not instantiated for any of the following
+/// elements. Otherwise, the fold may stop after any step, so all the steps
+/// have to yield the same type.
+///
+/// This takes a step (and a template instantiation) per element, but only as
+/// long as the steps yield compile-time booleans: from the first step which
+/// yields a runtime value, the following elements are folded by a single
+/// fold expression (if the accumulator can be assigned).
+template <std::size_t I, std::size_t N, typename Tuple, typename Combinator,
+          typename Acc>
+constexpr auto fold_left_while_from(Tuple &&tuple, Combinator &c, Acc acc) {
+    if constexpr (I == N) {
+        return acc;
+    } else {
+        using next_t = decltype(tr::invoke(
+            c, std::move(acc), at_c<I>(static_cast<Tuple &&>(tuple))));
+        static_assert(std::is_object_v<next_t>,
+                      "fold_left_while requires the combinator to return the "
+                      "accumulator by value");
+
+        next_t next(tr::invoke(c, std::move(acc),
+                               at_c<I>(static_cast<Tuple &&>(tuple))));
+
+        if constexpr (is_bool_constant_v<next_t>) {
+            if constexpr (next_t::value) {
+                return fold_left_while_from<I + 1, N>(
+                    static_cast<Tuple &&>(tuple), c, std::move(next));
+            } else {
+                return next;
+            }
+        } else if constexpr (std::is_move_assignable_v<next_t>) {
+            if (!next) {
+                return next;
+            }
+            return fold_left_while_fold<I + 1>(
+                static_cast<Tuple &&>(tuple), c, std::move(next),
+                std::make_index_sequence<N - I - 1>{});
+        } else {
+            using res_t = decltype(fold_left_while_from<I + 1, N>(
+                static_cast<Tuple &&>(tuple), c, std::move(next)));
+            static_assert(std::is_same_v<res_t, next_t>,
+                          "fold_left_while requires all the steps to yield "
+                          "the same type, unless it's a compile-time boolean");
+
+            if (!next) {
+                return next;
+            }
+
+            return fold_left_while_from<I + 1, N>(static_cast<Tuple &&>(tuple),
+                                                  c, std::move(next));
+        }
+    }
+}
+
+} // namespace detail
+
+template <typename T>
+struct fold_left_while_impl<
+    T, std::enable_if_t<is_implemented_v<at_impl<T>> &&
+                        is_implemented_v<length_impl<T>>>> {
+
+    template <typename Tuple, typename Init, typename Combinator>
+    static constexpr auto apply(Tuple &&tuple, Init &&init, Combinator &&c) {
+        constexpr std::size_t n{decltype(tr::length(tuple))::value};
+        using acc_t = std::decay_t<Init>;
+        return detail::fold_left_while_from<0, n>(
+            static_cast<Tuple &&>(tuple), c,
+            acc_t(static_cast<Init &&>(init)));
+    }
+};
+
+template <typename Tuple, typename Init, typename Combinator>
+[[nodiscard]] constexpr auto
+fold_left_while_t::operator()(Tuple &&tuple, Init &&init,
+                              Combinator &&c) const -> decltype(auto) {
+
+    using tuple_t = detail::remove_cvref_t<Tuple>;
+    return fold_left_while_impl<tuple_t>::apply(static_cast<Tuple &&>(tuple),
+                                                static_cast<Init &&>(init),
+                                                static_cast<Combinator &&>(c));
+}
+
+} // namespace tr
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <tr/algorithm/fwd/fold_tree.h>
+
+#include <tr/algorithm/fold_left.h>
+#include <tr/detail/type_traits.h>
+#include <tr/detail/utility.h>
+#include <tr/tuple.h>
+#include <tr/unpack.h>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief Reduce the elements of `refs` in `[Lo, Hi)`: each half of the range
+/// is reduced on its own, so the depth of the dependency chain is
+/// O(log(Hi - Lo)) rather than O(Hi - Lo).
+template <std::size_t Lo, std::size_t Hi, typename Op, typename Refs>
+constexpr auto fold_tree_range(Op &op, Refs &refs) -> decltype(auto) {
+    if constexpr (Hi - Lo == 1) {
+        return refs[zuic<Lo>];
+    } else {
+        constexpr std::size_t mid{Lo + (Hi - Lo) / 2};
+
+        // Evaluate the left subtree first.
+        auto &&lhs = fold_tree_range<Lo, mid>(op, refs);
+        return op(static_cast<decltype(lhs)>(lhs),
+                  fold_tree_range<mid, Hi>(op, refs));
+    }
+}
+
+template <typename Combinator, typename... Elems>
+constexpr auto fold_tree_elems(Combinator &c, Elems &&...elems)
+    -> decltype(auto) {
+    static_assert(sizeof...(Elems) != 0,
+                  "fold_tree requires a non-empty tuple or an initial value");
+
+    auto &&op = detail::fold_op_for(c);
+    auto refs = tr::forward_as_tuple(static_cast<Elems &&>(elems)...);
+    return detail::lref_or_value(
+        fold_tree_range<0, sizeof...(Elems)>(op, refs));
+}
+
+} // namespace detail
+
+template <typename T>
+struct fold_tree_impl<T, std::enable_if_t<is_implemented_v<unpack_impl<T>>>> {
+
+    template <typename NonEmptyTuple, typename BinaryOp>
+    static constexpr auto apply(NonEmptyTuple &&tuple, BinaryOp &&op)
+        -> decltype(auto) {
+
+        auto fold = [&op](auto &&...elems) -> decltype(auto) {
+            return detail::fold_tree_elems(
+                op, static_cast<decltype(elems)>(elems)...);
+        };
+
+        return unpack(static_cast<NonEmptyTuple &&>(tuple), fold);
+    }
+
+    template <typename Tuple, typename Init, typename BinaryOp>
+    static constexpr auto apply(Tuple &&tuple, Init &&init, BinaryOp &&op)
+        -> decltype(auto) {
+
+        auto fold = [&](auto &&...elems) -> decltype(auto) {
+            return detail::fold_tree_elems(
+                op, static_cast<Init &&>(init),
+                static_cast<decltype(elems)>(elems)...);
+        };
+
+        return unpack(static_cast<Tuple &&>(tuple), fold);
+    }
+};
+
+template <typename NonEmptyTuple, typename BinaryOp>
+[[nodiscard]] constexpr auto
+fold_tree_t::operator()(NonEmptyTuple &&tuple, BinaryOp &&op) const
+    -> decltype(auto) {
+
+    using tuple_t = detail::remove_cvref_t<NonEmptyTuple>;
+    return fold_tree_impl<tuple_t>::apply(static_cast<NonEmptyTuple &&>(tuple),
+                                          static_cast<BinaryOp &&>(op));
+}
+
+template <typename Tuple, typename Init, typename BinaryOp>
+[[nodiscard]] constexpr auto fold_tree_t::operator()(Tuple &&tuple,
+                                                     Init &&init,
+                                                     BinaryOp &&op) const
+    -> decltype(auto) {
+
+    using tuple_t = detail::remove_cvref_t<Tuple>;
+    return fold_tree_impl<tuple_t>::apply(static_cast<Tuple &&>(tuple),
+                                          static_cast<Init &&>(init),
+                                          static_cast<BinaryOp &&>(op));
+}
+
+} // namespace tr
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <tr/algorithm/fwd/for_each_while.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/invoke.h>
+#include <tr/length.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief Apply `func` to the elements of `tuple` from the `I`-th one, as long
+/// as it returns a truthy value, with a short-circuiting fold.
+template <std::size_t I, typename Tuple, typename Func, std::size_t... Is>
+constexpr auto for_each_while_fold(Tuple &&tuple, Func &func,
+                                   std::index_sequence<Is...>) -> bool {
+    return (static_cast<bool>(tr::invoke(
+                func, at_c<I + Is>(static_cast<Tuple &&>(tuple)))) &&
+            ...);
+}
+
+/// @brief Apply `func` to the elements of `tuple` from the `I`-th one, until
+/// it returns a falsy value.
+///
+/// @details If `func` returns a compile-time `false` (e.g.
+/// `value_constant<false>`), `func` is not instantiated for any of the
+/// following elements. This takes a step (and a template instantiation) per
+/// element, but only as long as `func` returns compile-time booleans: from
+/// the first element on which it returns a runtime value, the following
+/// elements are visited by a single fold.
+///
+/// @return `true` (or `true_c`) if `func` was applied to all the elements,
+/// `false` (or `false_c`) otherwise.
+template <std::size_t I, std::size_t N, typename Tuple, typename Func>
+constexpr auto for_each_while_from(Tuple &&tuple, Func &func) {
+    if constexpr (I == N) {
+        return true_c;
+    } else {
+        using res_t = decltype(tr::invoke(
+            func, at_c<I>(static_cast<Tuple &&>(tuple))));
+
+        if constexpr (is_bool_constant_v<remove_cvref_t<res_t>>) {
+            (void)tr::invoke(func, at_c<I>(static_cast<Tuple &&>(tuple)));
+
+            if constexpr (remove_cvref_t<res_t>::value) {
+                return for_each_while_from<I + 1, N>(
+                    static_cast<Tuple &&>(tuple), func);
+            } else {
+                return false_c;
+            }
+        } else {
+            return for_each_while_fold<I>(static_cast<Tuple &&>(tuple), func,
+                                          std::make_index_sequence<N - I>{});
+        }
+    }
+}
+
+} // namespace detail
+
+template <typename Tuple, typename UnaryFunc>
+constexpr auto for_each_while_t::operator()(Tuple &&tuple,
+                                            UnaryFunc &&func) const
+    -> decltype(auto) {
+
+    using tuple_t = detail::remove_cvref_t<Tuple>;
+    return for_each_while_impl<tuple_t>::apply(
+        static_cast<Tuple &&>(tuple), static_cast<UnaryFunc &&>(func));
+}
+
+template <typename T>
+struct for_each_while_impl<
+    T, std::enable_if_t<is_implemented_v<at_impl<T>> &&
+                        is_implemented_v<length_impl<T>>>> {
+
+    template <typename Tuple, typename Func>
+    static constexpr auto apply(Tuple &&tuple, Func &&func) {
+        constexpr std::size_t n{decltype(tr::length(tuple))::value};
+        return detail::for_each_while_from<0, n>(static_cast<Tuple &&>(tuple),
+                                                 func);
+    }
+};
+
+} // namespace tr
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <tr/unimplemented.h>
+
+namespace tr {
+
+template <typename, typename = void>
+struct fold_left_while_impl : unimplemented {
+    template <typename Tuple, typename Init, typename Combinator>
+    static auto apply(Tuple &&, Init &&, Combinator &&) = delete;
+};
+
+struct fold_left_while_t {
+
+    /// @brief Perform a left fold on a tuple-like object, until the
+    /// accumulator is falsy.
+    /// @tparam Tuple The type of the tuple-like object.
+    /// @tparam Init The type of the initial value.
+    /// @tparam Combinator The combinator type (i.e. the binary operator to
+    /// fold onto).
+    /// @param  tuple The tuple-like object.
+    /// @param  init The initial value.
+    /// @param  c The binary operator.
+    /// @return The first falsy accumulator, or the result of the whole fold.
+    template <typename Tuple, typename Init, typename Combinator>
+    [[nodiscard]] constexpr auto operator()(Tuple &&, Init &&,
+                                            Combinator &&) const
+        -> decltype(auto);
+};
+
+static constexpr fold_left_while_t fold_left_while{};
+
+} // namespace tr
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <tr/unimplemented.h>
+
+namespace tr {
+
+template <typename, typename = void>
+struct fold_tree_impl : unimplemented {
+    template <typename NonEmptyTuple, typename BinaryOp>
+    static auto apply(NonEmptyTuple &&, BinaryOp &&) = delete;
+
+    template <typename Tuple, typename Init, typename BinaryOp>
+    static auto apply(Tuple &&, Init &&, BinaryOp &&) = delete;
+};
+
+struct fold_tree_t {
+    /// @brief Reduce a tuple-like object by combining its elements pairwise,
+    /// in a balanced tree.
+    /// @details Unlike `fold_left`, the steps don't form a single dependency
+    /// chain: `op` must be associative.
+    /// @tparam NonEmptyTuple The type of the tuple-like object.
+    /// @tparam BinaryOp The type of the associative binary operator.
+    /// @param tuple The tuple-like object.
+    /// @param op The associative binary operator.
+    /// @return The result of `op(op(tuple[0_ic], tuple[1_ic]),
+    /// op(tuple[2_ic], tuple[3_ic]))` (e.g. for 4 elements).
+    template <typename NonEmptyTuple, typename BinaryOp>
+    [[nodiscard]] constexpr auto operator()(NonEmptyTuple &&,
+                                            BinaryOp &&) const
+        -> decltype(auto);
+
+    /// @brief Reduce `init` and the elements of a tuple-like object by
+    /// combining them pairwise, in a balanced tree.
+    /// @tparam Tuple The type of the tuple-like object.
+    /// @tparam Init The type of the initial value.
+    /// @tparam BinaryOp The type of the associative binary operator.
+    /// @param tuple The tuple-like object.
+    /// @param init The initial value, i.e. the leftmost leaf of the tree.
+    /// @param op The associative binary operator.
+    template <typename Tuple, typename Init, typename BinaryOp>
+    [[nodiscard]] constexpr auto operator()(Tuple &&, Init &&,
+                                            BinaryOp &&) const
+        -> decltype(auto);
+};
+
+static constexpr fold_tree_t fold_tree{};
+
+} // namespace tr
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <tr/unimplemented.h>
+
+namespace tr {
+
+template <typename, typename = void>
+struct for_each_while_impl : unimplemented {
+    template <typename T, typename UnaryFunc>
+    static auto apply(T &&, UnaryFunc &&) = delete;
+};
+
+/// @brief Apply a `UnaryFunc` to each element in a sequence, until it returns
+/// a falsy value.
+struct for_each_while_t {
+    template <typename T, typename UnaryFunc>
+    constexpr auto operator()(T &&, UnaryFunc &&) const -> decltype(auto);
+};
+
+static constexpr for_each_while_t for_each_while{};
+
+} // namespace tr
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <tr/fwd/compressed_tuple.h>
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+
+#include <tr/detail/ebo.h>
+#include <tr/detail/index_array.h>
+#include <tr/detail/nth_type.h>
+#include <tr/detail/type_traits.h>
+#include <tr/detail/utility.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol.h>
+#include <tr/type_pack.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief Find the index of the first occurrence of `T` in `Ts...`.
+/// @return The index of `T` in `Ts...`, or `sizeof...(Ts)` if `T` is not there.
+template <typename T, typename... Ts>
+[[nodiscard]] constexpr auto first_index_of() noexcept -> std::size_t {
+    bool const same[]{std::is_same_v<T, Ts>..., true};
+    std::size_t i{};
+    while (!same[i]) {
+        ++i;
+    }
+    return i;
+}
+
+template <typename TL, typename IL = void>
+struct compressed_storage;
+
+/// @brief Select the storage layout of a `compressed_tuple<Ts...>`.
+///
+/// @details An element whose type can be compressed by `ebo` is only stored if
+/// it's the first element of that type. All of the following elements of the
+/// same type alias the first one: as they are empty, they have no state to
+/// keep apart.
+///
+/// @tparam ...Ts The types stored by the tuple, in declaration order.
+template <typename... Ts>
+struct compressed_storage<type_pack<Ts...>, void>
+    : compressed_storage<type_pack<Ts...>, std::index_sequence_for<Ts...>> {};
+
+template <typename... Ts, std::size_t... Is>
+struct compressed_storage<type_pack<Ts...>, std::index_sequence<Is...>> {
+
+    /// @brief The index of the stored element each logical index refers to.
+    static constexpr index_array<sizeof...(Ts)> aliases{
+        {(is_ebo_compressible_v<Ts> ? first_index_of<Ts, Ts...>() : Is)...}};
+
+  private:
+    static constexpr std::size_t stored_count{
+        (std::size_t{aliases.Idx_[Is] == Is} + ... + 0)};
+
+    [[nodiscard]] static constexpr auto stored_indices() noexcept {
+        index_array<stored_count> stored{};
+        std::size_t j{};
+        for (std::size_t i{}; i != sizeof...(Ts); ++i) {
+            if (aliases.Idx_[i] == i) {
+                stored.Idx_[j++] = i;
+            }
+        }
+        return stored;
+    }
+
+    static constexpr auto stored{stored_indices()};
+
+    template <std::size_t I>
+    using nth_t = nth_type_t<I, Ts...>;
+
+    template <std::size_t... Ks>
+    static auto storage_for(std::index_sequence<Ks...>)
+        -> tuple_base<type_pack<nth_t<stored.Idx_[Ks]>...>,
+                      std::index_sequence<stored.Idx_[Ks]...>>
+    /* undefined */;
+
+    template <std::size_t... Ks>
+    static auto sequence_for(std::index_sequence<Ks...>)
+        -> std::index_sequence<stored.Idx_[Ks]...> /* undefined */;
+
+    using stored_sequence_t = std::make_index_sequence<stored_count>;
+
+  public:
+    using index_sequence_t = decltype(sequence_for(stored_sequence_t{}));
+    using type = decltype(storage_for(stored_sequence_t{}));
+};
+
+/// @brief Tag type to select the private constructor of `compressed_tuple`.
+struct compressed_init_t {};
+
+} // namespace detail
+
+/// @brief A fixed-size collection of (possibly) heterogeneous values where
+/// every empty, non-final element occupies no storage.
+///
+/// @details In a `tuple`, each element is a distinct base class subobject. Two
+/// subobjects of the same empty type must have distinct addresses, so (e.g.)
+/// `tuple<std::allocator<int>, std::allocator<int>>` can't be empty.
+/// `compressed_tuple` only stores the first element of each empty type; all
+/// other elements of that type refer to it:
+///
+/// @code
+/// using alloc_t = std::allocator<int>;
+/// static_assert(sizeof(tr::compressed_tuple<int, alloc_t, alloc_t>) ==
+///               sizeof(int));
+///
+/// tr::compressed_tuple<int, alloc_t, alloc_t> t{};
+/// assert(&t[1_zuic] == &t[2_zuic]);
+/// @endcode
+///
+/// As a consequence, the constructor arguments for repeated empty elements are
+/// not used, and `compressed_tuple` is not an aggregate.
+///
+/// @tparam ...Ts The types stored by the tuple (can be empty).
+template <typename... Ts>
+struct compressed_tuple : detail::compressed_storage<type_pack<Ts...>>::type {
+  private:
+    using storage_t = detail::compressed_storage<type_pack<Ts...>>;
+    using base_t = typename storage_t::type;
+    using storage_sequence_t = typename storage_t::index_sequence_t;
+
+    template <std::size_t I>
+    static constexpr std::integral_constant<std::size_t,
+                                            storage_t::aliases.Idx_[I]>
+        storage_idx{};
+
+    template <typename... Us>
+    static constexpr bool is_element_wise_v{
+        sizeof...(Us) == sizeof...(Ts) && sizeof...(Ts) != 0 &&
+        (!std::is_same_v<detail::remove_cvref_t<Us>, compressed_tuple> &&
+         ...)};
+
+    template <typename Args, std::size_t... Ks>
+    constexpr compressed_tuple(detail::compressed_init_t, Args &&args,
+                               std::index_sequence<Ks...>)
+        : base_t{static_cast<Args &&>(args)[zuic<Ks>]...} {}
+
+  public:
+    using base_t::operator=;
+
+    /// @brief Default constructor.
+    constexpr compressed_tuple() = default;
+
+    /// @brief Construct each stored element from a copy of the corresponding
+    /// argument.
+    /// @details This overload allows initializing elements from braced lists.
+    /// @param ...args The arguments, in declaration order.
+    template <typename Dummy = void,
+              typename = std::enable_if_t<sizeof...(Ts) != 0, Dummy>>
+    constexpr compressed_tuple(Ts const &...args)
+        : compressed_tuple(detail::compressed_init_t{},
+                           tr::forward_as_tuple(args...),
+                           storage_sequence_t{}) {}
+
+    /// @brief Construct each stored element from the corresponding argument.
+    /// @param ...args The arguments, in declaration order.
+    template <typename... Us,
+              typename = std::enable_if_t<is_element_wise_v<Us...>>>
+    constexpr compressed_tuple(Us &&...args)
+        : compressed_tuple(detail::compressed_init_t{},
+                           tr::forward_as_tuple(static_cast<Us &&>(args)...),
+                           storage_sequence_t{}) {}
+
+    template <typename Int, Int I>
+    [[nodiscard]] constexpr auto
+    operator[](std::integral_constant<Int, I>) const &noexcept
+        -> decltype(auto) {
+        return static_cast<base_t const &>(*this)[storage_idx<I>];
+    }
+
+    template <typename Int, Int I>
+    [[nodiscard]] constexpr auto
+    operator[](std::integral_constant<Int, I>) &noexcept -> decltype(auto) {
+        return static_cast<base_t &>(*this)[storage_idx<I>];
+    }
+
+    template <typename Int, Int I>
+    [[nodiscard]] constexpr auto
+    operator[](std::integral_constant<Int, I>) const &&noexcept
+        -> decltype(auto) {
+        return static_cast<base_t const &&>(*this)[storage_idx<I>];
+    }
+
+    template <typename Int, Int I>
+    [[nodiscard]] constexpr auto
+    operator[](std::integral_constant<Int, I>) &&noexcept -> decltype(auto) {
+        return static_cast<base_t &&>(*this)[storage_idx<I>];
+    }
+};
+
+template <typename... Ts>
+compressed_tuple(Ts const &...) -> compressed_tuple<Ts...>;
+
+/// @brief Swap two compressed tuples of the same type.
+///
+/// @param lhs The left-hand-side tuple.
+/// @param rhs The right-hand-side tuple.
+template <typename... Ts>
+constexpr auto
+swap(compressed_tuple<Ts...> &lhs,
+     compressed_tuple<Ts...> &rhs) noexcept(noexcept(lhs.swap(rhs)))
+    -> decltype(lhs.swap(rhs)) {
+    lhs.swap(rhs);
+}
+
+// -- Tuple protocol
+template <typename... Ts>
+struct tup_size<compressed_tuple<Ts...>>
+    : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+// --
+
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(compressed_tuple<Ts...> const &t) noexcept {
+    return detail::tuple_get<I>(t);
+}
+
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(compressed_tuple<Ts...> &t) noexcept {
+    return detail::tuple_get<I>(t);
+}
+
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(compressed_tuple<Ts...> &&t) noexcept {
+    return detail::tuple_get<I>(std::move(t));
+}
+
+template <typename... Ts>
+struct at_impl<compressed_tuple<Ts...>> : at_impl<tuple<Ts...>> {};
+
+template <typename... Ts>
+struct length_impl<compressed_tuple<Ts...>> : length_impl<tuple<Ts...>> {};
+
+} // namespace tr
+
+namespace std {
+
+template <typename... Ts>
+struct tuple_size<::tr::compressed_tuple<Ts...>>
+    : integral_constant<size_t, sizeof...(Ts)> {};
+
+template <size_t I, typename... Ts>
+struct tuple_element<I, ::tr::compressed_tuple<Ts...>>
+    : tuple_element<I, ::tr::tuple<Ts...>> {};
+} // namespace std
@@ -0,0 +1,442 @@
+#pragma once
+
+// The structured bindings which give access to the fields of an aggregate
+// with up to 128 fields (see <tr/tuple_protocol/aggregate.h>): this file is
+// mostly made of a macro per field count, and `aggregate_fields<N>` is
+// specialized for each of them.
+
+#include <tr/detail/utility.h>
+#include <tr/macros.h>
+
+#include <cstddef>
+#include <utility>
+
+namespace tr {
+namespace detail {
+
+/// @brief The maximum number of fields of an aggregate used as a tuple.
+static constexpr std::size_t aggregate_max_fields{128};
+
+/// @brief Call `func` on the fields of an aggregate, each forwarded as the
+/// aggregate is (i.e. as `get` would return them).
+template <typename Aggregate, typename Func, typename... Fields>
+TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+aggregate_call(Func &&func, Fields &...fields) -> decltype(auto) {
+    return static_cast<Func &&>(func)(forward_like<Aggregate>(fields)...);
+}
+
+template <std::size_t N>
+struct aggregate_fields;
+
+template <>
+struct aggregate_fields<0> {
+    template <typename Aggregate, typename Func>
+    TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    unpack(Aggregate &&, Func &&func) -> decltype(auto) {
+        return static_cast<Func &&>(func)();
+    }
+};
+
+#define TR_AGGREGATE_BINDINGS_1 f0
+#define TR_AGGREGATE_BINDINGS_2 TR_AGGREGATE_BINDINGS_1, f1
+#define TR_AGGREGATE_BINDINGS_3 TR_AGGREGATE_BINDINGS_2, f2
+#define TR_AGGREGATE_BINDINGS_4 TR_AGGREGATE_BINDINGS_3, f3
+#define TR_AGGREGATE_BINDINGS_5 TR_AGGREGATE_BINDINGS_4, f4
+#define TR_AGGREGATE_BINDINGS_6 TR_AGGREGATE_BINDINGS_5, f5
+#define TR_AGGREGATE_BINDINGS_7 TR_AGGREGATE_BINDINGS_6, f6
+#define TR_AGGREGATE_BINDINGS_8 TR_AGGREGATE_BINDINGS_7, f7
+#define TR_AGGREGATE_BINDINGS_9 TR_AGGREGATE_BINDINGS_8, f8
+#define TR_AGGREGATE_BINDINGS_10 TR_AGGREGATE_BINDINGS_9, f9
+#define TR_AGGREGATE_BINDINGS_11 TR_AGGREGATE_BINDINGS_10, f10
+#define TR_AGGREGATE_BINDINGS_12 TR_AGGREGATE_BINDINGS_11, f11
+#define TR_AGGREGATE_BINDINGS_13 TR_AGGREGATE_BINDINGS_12, f12
+#define TR_AGGREGATE_BINDINGS_14 TR_AGGREGATE_BINDINGS_13, f13
+#define TR_AGGREGATE_BINDINGS_15 TR_AGGREGATE_BINDINGS_14, f14
+#define TR_AGGREGATE_BINDINGS_16 TR_AGGREGATE_BINDINGS_15, f15
+#define TR_AGGREGATE_BINDINGS_17 TR_AGGREGATE_BINDINGS_16, f16
+#define TR_AGGREGATE_BINDINGS_18 TR_AGGREGATE_BINDINGS_17, f17
+#define TR_AGGREGATE_BINDINGS_19 TR_AGGREGATE_BINDINGS_18, f18
+#define TR_AGGREGATE_BINDINGS_20 TR_AGGREGATE_BINDINGS_19, f19
+#define TR_AGGREGATE_BINDINGS_21 TR_AGGREGATE_BINDINGS_20, f20
+#define TR_AGGREGATE_BINDINGS_22 TR_AGGREGATE_BINDINGS_21, f21
+#define TR_AGGREGATE_BINDINGS_23 TR_AGGREGATE_BINDINGS_22, f22
+#define TR_AGGREGATE_BINDINGS_24 TR_AGGREGATE_BINDINGS_23, f23
+#define TR_AGGREGATE_BINDINGS_25 TR_AGGREGATE_BINDINGS_24, f24
+#define TR_AGGREGATE_BINDINGS_26 TR_AGGREGATE_BINDINGS_25, f25
+#define TR_AGGREGATE_BINDINGS_27 TR_AGGREGATE_BINDINGS_26, f26
+#define TR_AGGREGATE_BINDINGS_28 TR_AGGREGATE_BINDINGS_27, f27
+#define TR_AGGREGATE_BINDINGS_29 TR_AGGREGATE_BINDINGS_28, f28
+#define TR_AGGREGATE_BINDINGS_30 TR_AGGREGATE_BINDINGS_29, f29
+#define TR_AGGREGATE_BINDINGS_31 TR_AGGREGATE_BINDINGS_30, f30
+#define TR_AGGREGATE_BINDINGS_32 TR_AGGREGATE_BINDINGS_31, f31
+#define TR_AGGREGATE_BINDINGS_33 TR_AGGREGATE_BINDINGS_32, f32
+#define TR_AGGREGATE_BINDINGS_34 TR_AGGREGATE_BINDINGS_33, f33
+#define TR_AGGREGATE_BINDINGS_35 TR_AGGREGATE_BINDINGS_34, f34
+#define TR_AGGREGATE_BINDINGS_36 TR_AGGREGATE_BINDINGS_35, f35
+#define TR_AGGREGATE_BINDINGS_37 TR_AGGREGATE_BINDINGS_36, f36
+#define TR_AGGREGATE_BINDINGS_38 TR_AGGREGATE_BINDINGS_37, f37
+#define TR_AGGREGATE_BINDINGS_39 TR_AGGREGATE_BINDINGS_38, f38
+#define TR_AGGREGATE_BINDINGS_40 TR_AGGREGATE_BINDINGS_39, f39
+#define TR_AGGREGATE_BINDINGS_41 TR_AGGREGATE_BINDINGS_40, f40
+#define TR_AGGREGATE_BINDINGS_42 TR_AGGREGATE_BINDINGS_41, f41
+#define TR_AGGREGATE_BINDINGS_43 TR_AGGREGATE_BINDINGS_42, f42
+#define TR_AGGREGATE_BINDINGS_44 TR_AGGREGATE_BINDINGS_43, f43
+#define TR_AGGREGATE_BINDINGS_45 TR_AGGREGATE_BINDINGS_44, f44
+#define TR_AGGREGATE_BINDINGS_46 TR_AGGREGATE_BINDINGS_45, f45
+#define TR_AGGREGATE_BINDINGS_47 TR_AGGREGATE_BINDINGS_46, f46
+#define TR_AGGREGATE_BINDINGS_48 TR_AGGREGATE_BINDINGS_47, f47
+#define TR_AGGREGATE_BINDINGS_49 TR_AGGREGATE_BINDINGS_48, f48
+#define TR_AGGREGATE_BINDINGS_50 TR_AGGREGATE_BINDINGS_49, f49
+#define TR_AGGREGATE_BINDINGS_51 TR_AGGREGATE_BINDINGS_50, f50
+#define TR_AGGREGATE_BINDINGS_52 TR_AGGREGATE_BINDINGS_51, f51
+#define TR_AGGREGATE_BINDINGS_53 TR_AGGREGATE_BINDINGS_52, f52
+#define TR_AGGREGATE_BINDINGS_54 TR_AGGREGATE_BINDINGS_53, f53
+#define TR_AGGREGATE_BINDINGS_55 TR_AGGREGATE_BINDINGS_54, f54
+#define TR_AGGREGATE_BINDINGS_56 TR_AGGREGATE_BINDINGS_55, f55
+#define TR_AGGREGATE_BINDINGS_57 TR_AGGREGATE_BINDINGS_56, f56
+#define TR_AGGREGATE_BINDINGS_58 TR_AGGREGATE_BINDINGS_57, f57
+#define TR_AGGREGATE_BINDINGS_59 TR_AGGREGATE_BINDINGS_58, f58
+#define TR_AGGREGATE_BINDINGS_60 TR_AGGREGATE_BINDINGS_59, f59
+#define TR_AGGREGATE_BINDINGS_61 TR_AGGREGATE_BINDINGS_60, f60
+#define TR_AGGREGATE_BINDINGS_62 TR_AGGREGATE_BINDINGS_61, f61
+#define TR_AGGREGATE_BINDINGS_63 TR_AGGREGATE_BINDINGS_62, f62
+#define TR_AGGREGATE_BINDINGS_64 TR_AGGREGATE_BINDINGS_63, f63
+#define TR_AGGREGATE_BINDINGS_65 TR_AGGREGATE_BINDINGS_64, f64
+#define TR_AGGREGATE_BINDINGS_66 TR_AGGREGATE_BINDINGS_65, f65
+#define TR_AGGREGATE_BINDINGS_67 TR_AGGREGATE_BINDINGS_66, f66
+#define TR_AGGREGATE_BINDINGS_68 TR_AGGREGATE_BINDINGS_67, f67
+#define TR_AGGREGATE_BINDINGS_69 TR_AGGREGATE_BINDINGS_68, f68
+#define TR_AGGREGATE_BINDINGS_70 TR_AGGREGATE_BINDINGS_69, f69
+#define TR_AGGREGATE_BINDINGS_71 TR_AGGREGATE_BINDINGS_70, f70
+#define TR_AGGREGATE_BINDINGS_72 TR_AGGREGATE_BINDINGS_71, f71
+#define TR_AGGREGATE_BINDINGS_73 TR_AGGREGATE_BINDINGS_72, f72
+#define TR_AGGREGATE_BINDINGS_74 TR_AGGREGATE_BINDINGS_73, f73
+#define TR_AGGREGATE_BINDINGS_75 TR_AGGREGATE_BINDINGS_74, f74
+#define TR_AGGREGATE_BINDINGS_76 TR_AGGREGATE_BINDINGS_75, f75
+#define TR_AGGREGATE_BINDINGS_77 TR_AGGREGATE_BINDINGS_76, f76
+#define TR_AGGREGATE_BINDINGS_78 TR_AGGREGATE_BINDINGS_77, f77
+#define TR_AGGREGATE_BINDINGS_79 TR_AGGREGATE_BINDINGS_78, f78
+#define TR_AGGREGATE_BINDINGS_80 TR_AGGREGATE_BINDINGS_79, f79
+#define TR_AGGREGATE_BINDINGS_81 TR_AGGREGATE_BINDINGS_80, f80
+#define TR_AGGREGATE_BINDINGS_82 TR_AGGREGATE_BINDINGS_81, f81
+#define TR_AGGREGATE_BINDINGS_83 TR_AGGREGATE_BINDINGS_82, f82
+#define TR_AGGREGATE_BINDINGS_84 TR_AGGREGATE_BINDINGS_83, f83
+#define TR_AGGREGATE_BINDINGS_85 TR_AGGREGATE_BINDINGS_84, f84
+#define TR_AGGREGATE_BINDINGS_86 TR_AGGREGATE_BINDINGS_85, f85
+#define TR_AGGREGATE_BINDINGS_87 TR_AGGREGATE_BINDINGS_86, f86
+#define TR_AGGREGATE_BINDINGS_88 TR_AGGREGATE_BINDINGS_87, f87
+#define TR_AGGREGATE_BINDINGS_89 TR_AGGREGATE_BINDINGS_88, f88
+#define TR_AGGREGATE_BINDINGS_90 TR_AGGREGATE_BINDINGS_89, f89
+#define TR_AGGREGATE_BINDINGS_91 TR_AGGREGATE_BINDINGS_90, f90
+#define TR_AGGREGATE_BINDINGS_92 TR_AGGREGATE_BINDINGS_91, f91
+#define TR_AGGREGATE_BINDINGS_93 TR_AGGREGATE_BINDINGS_92, f92
+#define TR_AGGREGATE_BINDINGS_94 TR_AGGREGATE_BINDINGS_93, f93
+#define TR_AGGREGATE_BINDINGS_95 TR_AGGREGATE_BINDINGS_94, f94
+#define TR_AGGREGATE_BINDINGS_96 TR_AGGREGATE_BINDINGS_95, f95
+#define TR_AGGREGATE_BINDINGS_97 TR_AGGREGATE_BINDINGS_96, f96
+#define TR_AGGREGATE_BINDINGS_98 TR_AGGREGATE_BINDINGS_97, f97
+#define TR_AGGREGATE_BINDINGS_99 TR_AGGREGATE_BINDINGS_98, f98
+#define TR_AGGREGATE_BINDINGS_100 TR_AGGREGATE_BINDINGS_99, f99
+#define TR_AGGREGATE_BINDINGS_101 TR_AGGREGATE_BINDINGS_100, f100
+#define TR_AGGREGATE_BINDINGS_102 TR_AGGREGATE_BINDINGS_101, f101
+#define TR_AGGREGATE_BINDINGS_103 TR_AGGREGATE_BINDINGS_102, f102
+#define TR_AGGREGATE_BINDINGS_104 TR_AGGREGATE_BINDINGS_103, f103
+#define TR_AGGREGATE_BINDINGS_105 TR_AGGREGATE_BINDINGS_104, f104
+#define TR_AGGREGATE_BINDINGS_106 TR_AGGREGATE_BINDINGS_105, f105
+#define TR_AGGREGATE_BINDINGS_107 TR_AGGREGATE_BINDINGS_106, f106
+#define TR_AGGREGATE_BINDINGS_108 TR_AGGREGATE_BINDINGS_107, f107
+#define TR_AGGREGATE_BINDINGS_109 TR_AGGREGATE_BINDINGS_108, f108
+#define TR_AGGREGATE_BINDINGS_110 TR_AGGREGATE_BINDINGS_109, f109
+#define TR_AGGREGATE_BINDINGS_111 TR_AGGREGATE_BINDINGS_110, f110
+#define TR_AGGREGATE_BINDINGS_112 TR_AGGREGATE_BINDINGS_111, f111
+#define TR_AGGREGATE_BINDINGS_113 TR_AGGREGATE_BINDINGS_112, f112
+#define TR_AGGREGATE_BINDINGS_114 TR_AGGREGATE_BINDINGS_113, f113
+#define TR_AGGREGATE_BINDINGS_115 TR_AGGREGATE_BINDINGS_114, f114
+#define TR_AGGREGATE_BINDINGS_116 TR_AGGREGATE_BINDINGS_115, f115
+#define TR_AGGREGATE_BINDINGS_117 TR_AGGREGATE_BINDINGS_116, f116
+#define TR_AGGREGATE_BINDINGS_118 TR_AGGREGATE_BINDINGS_117, f117
+#define TR_AGGREGATE_BINDINGS_119 TR_AGGREGATE_BINDINGS_118, f118
+#define TR_AGGREGATE_BINDINGS_120 TR_AGGREGATE_BINDINGS_119, f119
+#define TR_AGGREGATE_BINDINGS_121 TR_AGGREGATE_BINDINGS_120, f120
+#define TR_AGGREGATE_BINDINGS_122 TR_AGGREGATE_BINDINGS_121, f121
+#define TR_AGGREGATE_BINDINGS_123 TR_AGGREGATE_BINDINGS_122, f122
+#define TR_AGGREGATE_BINDINGS_124 TR_AGGREGATE_BINDINGS_123, f123
+#define TR_AGGREGATE_BINDINGS_125 TR_AGGREGATE_BINDINGS_124, f124
+#define TR_AGGREGATE_BINDINGS_126 TR_AGGREGATE_BINDINGS_125, f125
+#define TR_AGGREGATE_BINDINGS_127 TR_AGGREGATE_BINDINGS_126, f126
+#define TR_AGGREGATE_BINDINGS_128 TR_AGGREGATE_BINDINGS_127, f127
+
+#define TR_AGGREGATE_FIELDS(N)                                                 \
+    template <>                                                                \
+    struct aggregate_fields<N> {                                               \
+        template <typename Aggregate, typename Func>                           \
+        TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto                   \
+        unpack(Aggregate &&aggregate, Func &&func) -> decltype(auto) {         \
+            auto &[TR_AGGREGATE_BINDINGS_##N] = aggregate;                     \
+            return aggregate_call<Aggregate>(static_cast<Func &&>(func),       \
+                                             TR_AGGREGATE_BINDINGS_##N);       \
+        }                                                                      \
+    }
+
+TR_AGGREGATE_FIELDS(1);
+TR_AGGREGATE_FIELDS(2);
+TR_AGGREGATE_FIELDS(3);
+TR_AGGREGATE_FIELDS(4);
+TR_AGGREGATE_FIELDS(5);
+TR_AGGREGATE_FIELDS(6);
+TR_AGGREGATE_FIELDS(7);
+TR_AGGREGATE_FIELDS(8);
+TR_AGGREGATE_FIELDS(9);
+TR_AGGREGATE_FIELDS(10);
+TR_AGGREGATE_FIELDS(11);
+TR_AGGREGATE_FIELDS(12);
+TR_AGGREGATE_FIELDS(13);
+TR_AGGREGATE_FIELDS(14);
+TR_AGGREGATE_FIELDS(15);
+TR_AGGREGATE_FIELDS(16);
+TR_AGGREGATE_FIELDS(17);
+TR_AGGREGATE_FIELDS(18);
+TR_AGGREGATE_FIELDS(19);
+TR_AGGREGATE_FIELDS(20);
+TR_AGGREGATE_FIELDS(21);
+TR_AGGREGATE_FIELDS(22);
+TR_AGGREGATE_FIELDS(23);
+TR_AGGREGATE_FIELDS(24);
+TR_AGGREGATE_FIELDS(25);
+TR_AGGREGATE_FIELDS(26);
+TR_AGGREGATE_FIELDS(27);
+TR_AGGREGATE_FIELDS(28);
+TR_AGGREGATE_FIELDS(29);
+TR_AGGREGATE_FIELDS(30);
+TR_AGGREGATE_FIELDS(31);
+TR_AGGREGATE_FIELDS(32);
+TR_AGGREGATE_FIELDS(33);
+TR_AGGREGATE_FIELDS(34);
+TR_AGGREGATE_FIELDS(35);
+TR_AGGREGATE_FIELDS(36);
+TR_AGGREGATE_FIELDS(37);
+TR_AGGREGATE_FIELDS(38);
+TR_AGGREGATE_FIELDS(39);
+TR_AGGREGATE_FIELDS(40);
+TR_AGGREGATE_FIELDS(41);
+TR_AGGREGATE_FIELDS(42);
+TR_AGGREGATE_FIELDS(43);
+TR_AGGREGATE_FIELDS(44);
+TR_AGGREGATE_FIELDS(45);
+TR_AGGREGATE_FIELDS(46);
+TR_AGGREGATE_FIELDS(47);
+TR_AGGREGATE_FIELDS(48);
+TR_AGGREGATE_FIELDS(49);
+TR_AGGREGATE_FIELDS(50);
+TR_AGGREGATE_FIELDS(51);
+TR_AGGREGATE_FIELDS(52);
+TR_AGGREGATE_FIELDS(53);
+TR_AGGREGATE_FIELDS(54);
+TR_AGGREGATE_FIELDS(55);
+TR_AGGREGATE_FIELDS(56);
+TR_AGGREGATE_FIELDS(57);
+TR_AGGREGATE_FIELDS(58);
+TR_AGGREGATE_FIELDS(59);
+TR_AGGREGATE_FIELDS(60);
+TR_AGGREGATE_FIELDS(61);
+TR_AGGREGATE_FIELDS(62);
+TR_AGGREGATE_FIELDS(63);
+TR_AGGREGATE_FIELDS(64);
+TR_AGGREGATE_FIELDS(65);
+TR_AGGREGATE_FIELDS(66);
+TR_AGGREGATE_FIELDS(67);
+TR_AGGREGATE_FIELDS(68);
+TR_AGGREGATE_FIELDS(69);
+TR_AGGREGATE_FIELDS(70);
+TR_AGGREGATE_FIELDS(71);
+TR_AGGREGATE_FIELDS(72);
+TR_AGGREGATE_FIELDS(73);
+TR_AGGREGATE_FIELDS(74);
+TR_AGGREGATE_FIELDS(75);
+TR_AGGREGATE_FIELDS(76);
+TR_AGGREGATE_FIELDS(77);
+TR_AGGREGATE_FIELDS(78);
+TR_AGGREGATE_FIELDS(79);
+TR_AGGREGATE_FIELDS(80);
+TR_AGGREGATE_FIELDS(81);
+TR_AGGREGATE_FIELDS(82);
+TR_AGGREGATE_FIELDS(83);
+TR_AGGREGATE_FIELDS(84);
+TR_AGGREGATE_FIELDS(85);
+TR_AGGREGATE_FIELDS(86);
+TR_AGGREGATE_FIELDS(87);
+TR_AGGREGATE_FIELDS(88);
+TR_AGGREGATE_FIELDS(89);
+TR_AGGREGATE_FIELDS(90);
+TR_AGGREGATE_FIELDS(91);
+TR_AGGREGATE_FIELDS(92);
+TR_AGGREGATE_FIELDS(93);
+TR_AGGREGATE_FIELDS(94);
+TR_AGGREGATE_FIELDS(95);
+TR_AGGREGATE_FIELDS(96);
+TR_AGGREGATE_FIELDS(97);
+TR_AGGREGATE_FIELDS(98);
+TR_AGGREGATE_FIELDS(99);
+TR_AGGREGATE_FIELDS(100);
+TR_AGGREGATE_FIELDS(101);
+TR_AGGREGATE_FIELDS(102);
+TR_AGGREGATE_FIELDS(103);
+TR_AGGREGATE_FIELDS(104);
+TR_AGGREGATE_FIELDS(105);
+TR_AGGREGATE_FIELDS(106);
+TR_AGGREGATE_FIELDS(107);
+TR_AGGREGATE_FIELDS(108);
+TR_AGGREGATE_FIELDS(109);
+TR_AGGREGATE_FIELDS(110);
+TR_AGGREGATE_FIELDS(111);
+TR_AGGREGATE_FIELDS(112);
+TR_AGGREGATE_FIELDS(113);
+TR_AGGREGATE_FIELDS(114);
+TR_AGGREGATE_FIELDS(115);
+TR_AGGREGATE_FIELDS(116);
+TR_AGGREGATE_FIELDS(117);
+TR_AGGREGATE_FIELDS(118);
+TR_AGGREGATE_FIELDS(119);
+TR_AGGREGATE_FIELDS(120);
+TR_AGGREGATE_FIELDS(121);
+TR_AGGREGATE_FIELDS(122);
+TR_AGGREGATE_FIELDS(123);
+TR_AGGREGATE_FIELDS(124);
+TR_AGGREGATE_FIELDS(125);
+TR_AGGREGATE_FIELDS(126);
+TR_AGGREGATE_FIELDS(127);
+TR_AGGREGATE_FIELDS(128);
+
+#undef TR_AGGREGATE_FIELDS
+
+#undef TR_AGGREGATE_BINDINGS_1
+#undef TR_AGGREGATE_BINDINGS_2
+#undef TR_AGGREGATE_BINDINGS_3
+#undef TR_AGGREGATE_BINDINGS_4
+#undef TR_AGGREGATE_BINDINGS_5
+#undef TR_AGGREGATE_BINDINGS_6
+#undef TR_AGGREGATE_BINDINGS_7
+#undef TR_AGGREGATE_BINDINGS_8
+#undef TR_AGGREGATE_BINDINGS_9
+#undef TR_AGGREGATE_BINDINGS_10
+#undef TR_AGGREGATE_BINDINGS_11
+#undef TR_AGGREGATE_BINDINGS_12
+#undef TR_AGGREGATE_BINDINGS_13
+#undef TR_AGGREGATE_BINDINGS_14
+#undef TR_AGGREGATE_BINDINGS_15
+#undef TR_AGGREGATE_BINDINGS_16
+#undef TR_AGGREGATE_BINDINGS_17
+#undef TR_AGGREGATE_BINDINGS_18
+#undef TR_AGGREGATE_BINDINGS_19
+#undef TR_AGGREGATE_BINDINGS_20
+#undef TR_AGGREGATE_BINDINGS_21
+#undef TR_AGGREGATE_BINDINGS_22
+#undef TR_AGGREGATE_BINDINGS_23
+#undef TR_AGGREGATE_BINDINGS_24
+#undef TR_AGGREGATE_BINDINGS_25
+#undef TR_AGGREGATE_BINDINGS_26
+#undef TR_AGGREGATE_BINDINGS_27
+#undef TR_AGGREGATE_BINDINGS_28
+#undef TR_AGGREGATE_BINDINGS_29
+#undef TR_AGGREGATE_BINDINGS_30
+#undef TR_AGGREGATE_BINDINGS_31
+#undef TR_AGGREGATE_BINDINGS_32
+#undef TR_AGGREGATE_BINDINGS_33
+#undef TR_AGGREGATE_BINDINGS_34
+#undef TR_AGGREGATE_BINDINGS_35
+#undef TR_AGGREGATE_BINDINGS_36
+#undef TR_AGGREGATE_BINDINGS_37
+#undef TR_AGGREGATE_BINDINGS_38
+#undef TR_AGGREGATE_BINDINGS_39
+#undef TR_AGGREGATE_BINDINGS_40
+#undef TR_AGGREGATE_BINDINGS_41
+#undef TR_AGGREGATE_BINDINGS_42
+#undef TR_AGGREGATE_BINDINGS_43
+#undef TR_AGGREGATE_BINDINGS_44
+#undef TR_AGGREGATE_BINDINGS_45
+#undef TR_AGGREGATE_BINDINGS_46
+#undef TR_AGGREGATE_BINDINGS_47
+#undef TR_AGGREGATE_BINDINGS_48
+#undef TR_AGGREGATE_BINDINGS_49
+#undef TR_AGGREGATE_BINDINGS_50
+#undef TR_AGGREGATE_BINDINGS_51
+#undef TR_AGGREGATE_BINDINGS_52
+#undef TR_AGGREGATE_BINDINGS_53
+#undef TR_AGGREGATE_BINDINGS_54
+#undef TR_AGGREGATE_BINDINGS_55
+#undef TR_AGGREGATE_BINDINGS_56
+#undef TR_AGGREGATE_BINDINGS_57
+#undef TR_AGGREGATE_BINDINGS_58
+#undef TR_AGGREGATE_BINDINGS_59
+#undef TR_AGGREGATE_BINDINGS_60
+#undef TR_AGGREGATE_BINDINGS_61
+#undef TR_AGGREGATE_BINDINGS_62
+#undef TR_AGGREGATE_BINDINGS_63
+#undef TR_AGGREGATE_BINDINGS_64
+#undef TR_AGGREGATE_BINDINGS_65
+#undef TR_AGGREGATE_BINDINGS_66
+#undef TR_AGGREGATE_BINDINGS_67
+#undef TR_AGGREGATE_BINDINGS_68
+#undef TR_AGGREGATE_BINDINGS_69
+#undef TR_AGGREGATE_BINDINGS_70
+#undef TR_AGGREGATE_BINDINGS_71
+#undef TR_AGGREGATE_BINDINGS_72
+#undef TR_AGGREGATE_BINDINGS_73
+#undef TR_AGGREGATE_BINDINGS_74
+#undef TR_AGGREGATE_BINDINGS_75
+#undef TR_AGGREGATE_BINDINGS_76
+#undef TR_AGGREGATE_BINDINGS_77
+#undef TR_AGGREGATE_BINDINGS_78
+#undef TR_AGGREGATE_BINDINGS_79
+#undef TR_AGGREGATE_BINDINGS_80
+#undef TR_AGGREGATE_BINDINGS_81
+#undef TR_AGGREGATE_BINDINGS_82
+#undef TR_AGGREGATE_BINDINGS_83
+#undef TR_AGGREGATE_BINDINGS_84
+#undef TR_AGGREGATE_BINDINGS_85
+#undef TR_AGGREGATE_BINDINGS_86
+#undef TR_AGGREGATE_BINDINGS_87
+#undef TR_AGGREGATE_BINDINGS_88
+#undef TR_AGGREGATE_BINDINGS_89
+#undef TR_AGGREGATE_BINDINGS_90
+#undef TR_AGGREGATE_BINDINGS_91
+#undef TR_AGGREGATE_BINDINGS_92
+#undef TR_AGGREGATE_BINDINGS_93
+#undef TR_AGGREGATE_BINDINGS_94
+#undef TR_AGGREGATE_BINDINGS_95
+#undef TR_AGGREGATE_BINDINGS_96
+#undef TR_AGGREGATE_BINDINGS_97
+#undef TR_AGGREGATE_BINDINGS_98
+#undef TR_AGGREGATE_BINDINGS_99
+#undef TR_AGGREGATE_BINDINGS_100
+#undef TR_AGGREGATE_BINDINGS_101
+#undef TR_AGGREGATE_BINDINGS_102
+#undef TR_AGGREGATE_BINDINGS_103
+#undef TR_AGGREGATE_BINDINGS_104
+#undef TR_AGGREGATE_BINDINGS_105
+#undef TR_AGGREGATE_BINDINGS_106
+#undef TR_AGGREGATE_BINDINGS_107
+#undef TR_AGGREGATE_BINDINGS_108
+#undef TR_AGGREGATE_BINDINGS_109
+#undef TR_AGGREGATE_BINDINGS_110
+#undef TR_AGGREGATE_BINDINGS_111
+#undef TR_AGGREGATE_BINDINGS_112
+#undef TR_AGGREGATE_BINDINGS_113
+#undef TR_AGGREGATE_BINDINGS_114
+#undef TR_AGGREGATE_BINDINGS_115
+#undef TR_AGGREGATE_BINDINGS_116
+#undef TR_AGGREGATE_BINDINGS_117
+#undef TR_AGGREGATE_BINDINGS_118
+#undef TR_AGGREGATE_BINDINGS_119
+#undef TR_AGGREGATE_BINDINGS_120
+#undef TR_AGGREGATE_BINDINGS_121
+#undef TR_AGGREGATE_BINDINGS_122
+#undef TR_AGGREGATE_BINDINGS_123
+#undef TR_AGGREGATE_BINDINGS_124
+#undef TR_AGGREGATE_BINDINGS_125
+#undef TR_AGGREGATE_BINDINGS_126
+#undef TR_AGGREGATE_BINDINGS_127
+#undef TR_AGGREGATE_BINDINGS_128
+
+} // namespace detail
+} // namespace tr
@@ -3,27 +3,39 @@
 #include <tr/detail/type_traits.h>
 #include <tr/detail/utility.h>
 #include <tr/forward_as_base.h>
+#include <tr/macros.h>
 
 #include <type_traits>
 
 namespace tr {
 namespace detail {
 
+/// @brief A variable template which holds `true`, if `T` can be stored as an
+/// empty base class (and thus occupy no storage), and `false` otherwise.
+/// @tparam T The type to check.
+template <typename T>
+static constexpr bool is_ebo_compressible_v{
+    !std::is_reference_v<T> && !std::is_final_v<T> && std::is_empty_v<T>};
+
 template <typename T, typename Tag,
-          bool IsCompressed =
-              std::is_void_v<T> || (!std::is_reference_v<T> &&
-                                    !std::is_final_v<T> && std::is_empty_v<T>)>
+          bool IsCompressed = std::is_void_v<T> || is_ebo_compressible_v<T>>
 struct ebo : T {
-    [[nodiscard]] constexpr auto value() &noexcept -> T & { return *this; }
-    [[nodiscard]] constexpr auto value() const &noexcept -> T const & {
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() &noexcept -> T & {
+        return *this;
+    }
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() const &noexcept -> T const & {
         return *this;
     }
 
-    [[nodiscard]] constexpr auto value() &&noexcept -> T && {
-        return std::move(*this);
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() &&noexcept -> T && {
+        return static_cast<T &&>(*this);
     }
-    [[nodiscard]] constexpr auto value() const &&noexcept -> T const && {
-        return std::move(*this);
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() const &&noexcept -> T const && {
+        return static_cast<T const &&>(*this);
     }
 };
 
@@ -34,16 +46,22 @@ template <typename T, typename Tag>
 struct ebo<T, Tag, false> {
     T Val_;
 
-    [[nodiscard]] constexpr auto value() &noexcept -> T & { return this->Val_; }
-    [[nodiscard]] constexpr auto value() const &noexcept -> T const & {
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() &noexcept -> T & {
+        return this->Val_;
+    }
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() const &noexcept -> T const & {
         return this->Val_;
     }
 
-    [[nodiscard]] constexpr auto value() &&noexcept -> T && {
-        return std::move(*this).Val_;
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() &&noexcept -> T && {
+        return static_cast<T &&>(this->Val_);
     }
-    [[nodiscard]] constexpr auto value() const &&noexcept -> T const && {
-        return std::move(*this).Val_;
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() const &&noexcept -> T const && {
+        return static_cast<T const &&>(this->Val_);
     }
 };
 
@@ -51,7 +69,8 @@ template <typename T, typename Tag>
 struct ebo<T &&, Tag, false> {
     T &&Val_;
 
-    [[nodiscard]] constexpr auto value() const noexcept -> T && {
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() const noexcept -> T && {
         return static_cast<T &&>(this->Val_);
     }
 };
@@ -60,7 +79,8 @@ template <typename T, typename Tag>
 struct ebo<T &, Tag, false> {
     T &Val_;
 
-    [[nodiscard]] constexpr auto value() const noexcept -> T & {
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    value() const noexcept -> T & {
         return this->Val_;
     }
 };
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+namespace tr {
+namespace detail {
+
+/// @brief An array of `N` tuple indices that can be used in constant
+/// expressions (e.g. to compute a permutation of the elements of a tuple).
+/// @tparam N The number of indices (can be zero).
+template <std::size_t N>
+struct index_array {
+    std::size_t Idx_[N == 0 ? 1 : N];
+};
+
+} // namespace detail
+} // namespace tr
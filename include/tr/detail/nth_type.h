@@ -0,0 +1,88 @@
+#pragma once
+
+#include <tr/macros.h>
+#include <tr/type_identity.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+namespace detail {
+
+// Indexed lookups into packs. Looking up an element instantiates O(1)
+// templates, and the per-pack work is done once, when `type_list<Ts...>` (or
+// `value_list<Vals...>`) is instantiated.
+//
+// Naming `type_list<Ts...>` costs O(N) on each lookup, as the compiler has to
+// match the whole pack. Class templates that already have the pack at hand
+// should keep a `type_list` (or `value_list`, or `value_array`) member alias
+// and look up through it, rather than using `nth_type_t` and `nth_value_v`.
+
+#if !TR_HAS_TYPE_PACK_ELEMENT
+
+template <std::size_t I, typename T>
+struct indexed_type {};
+
+template <typename IdxPack, typename... Ts>
+struct indexed_types;
+
+template <std::size_t... Is, typename... Ts>
+struct indexed_types<std::index_sequence<Is...>, Ts...>
+    : indexed_type<Is, Ts>... {};
+
+/// @brief Select the `I`-th type of a pack: `T` is deduced from the only
+/// `indexed_type<I, T>` base of an `indexed_types`.
+template <std::size_t I, typename T>
+auto select_nth_type(indexed_type<I, T> const *)
+    -> type_identity<T> /* undefined */;
+
+#endif // !TR_HAS_TYPE_PACK_ELEMENT
+
+/// @brief A pack of types with O(1) indexed access.
+template <typename... Ts>
+struct type_list {
+#if TR_HAS_TYPE_PACK_ELEMENT
+    template <std::size_t I>
+    using nth_type = __type_pack_element<I, Ts...>;
+#else
+  private:
+    using indexed_t = indexed_types<std::index_sequence_for<Ts...>, Ts...>;
+
+  public:
+    template <std::size_t I>
+    using nth_type = typename decltype(select_nth_type<I>(
+        static_cast<indexed_t *>(nullptr)))::type;
+#endif // TR_HAS_TYPE_PACK_ELEMENT
+};
+
+/// @brief A pack of values with O(1) indexed access.
+template <auto... Vals>
+struct value_list {
+  private:
+    using types_t = type_list<std::integral_constant<decltype(Vals), Vals>...>;
+
+  public:
+    template <std::size_t I>
+    static constexpr auto nth_value{types_t::template nth_type<I>::value};
+};
+
+/// @brief A pack of values of the same type with O(1) indexed access.
+/// @details Prefer this to `value_list` for homogeneous packs: the values are
+/// stored in an array, so a lookup (`values[I]`) instantiates nothing.
+template <typename T, T... Vals>
+struct value_array {
+    static constexpr T values[sizeof...(Vals) == 0 ? 1 : sizeof...(Vals)]{
+        Vals...};
+};
+
+/// @brief The `I`-th type of `Ts...`.
+template <std::size_t I, typename... Ts>
+using nth_type_t = typename type_list<Ts...>::template nth_type<I>;
+
+/// @brief The `I`-th value of `Vals...`.
+template <std::size_t I, auto... Vals>
+static constexpr auto nth_value_v{value_list<Vals...>::template nth_value<I>};
+
+} // namespace detail
+} // namespace tr
@@ -0,0 +1,423 @@
+#pragma once
+
+// Preprocessor helpers of `TR_REFLECT` (see <tr/reflect.h>), which apply a
+// macro to each of up to 128 field names. `TR_DETAIL_REFLECT_EXPAND` makes
+// MSVC's traditional preprocessor split `__VA_ARGS__` into arguments.
+
+#define TR_DETAIL_REFLECT_EXPAND(...) __VA_ARGS__
+#define TR_DETAIL_REFLECT_CONCAT_IMPL(a, b) a##b
+#define TR_DETAIL_REFLECT_CONCAT(a, b) TR_DETAIL_REFLECT_CONCAT_IMPL(a, b)
+
+// The number of arguments (from 1 to 128).
+#define TR_DETAIL_REFLECT_COUNT(...)                                           \
+    TR_DETAIL_REFLECT_EXPAND(TR_DETAIL_REFLECT_COUNT_IMPL(                     \
+        __VA_ARGS__, 128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118,    \
+        117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104,  \
+        103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88,    \
+        87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71,    \
+        70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54,    \
+        53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37,    \
+        36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,    \
+        19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+
+#define TR_DETAIL_REFLECT_COUNT_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10,  \
+    _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24,      \
+    _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38,      \
+    _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52,      \
+    _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66,      \
+    _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80,      \
+    _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94,      \
+    _95, _96, _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107,   \
+    _108, _109, _110, _111, _112, _113, _114, _115, _116, _117, _118, _119,    \
+    _120, _121, _122, _123, _124, _125, _126, _127, _128, N, ...)              \
+    N
+
+// Apply `M(T, field)` to each field, separated by commas.
+#define TR_DETAIL_REFLECT_FOR_EACH(M, T, ...)                                  \
+    TR_DETAIL_REFLECT_EXPAND(                                                  \
+        TR_DETAIL_REFLECT_CONCAT(TR_DETAIL_REFLECT_FOR_EACH_,                  \
+                                 TR_DETAIL_REFLECT_COUNT(__VA_ARGS__))(        \
+            M, T, __VA_ARGS__))
+
+#define TR_DETAIL_REFLECT_FOR_EACH_1(M, T, f) M(T, f)
+#define TR_DETAIL_REFLECT_FOR_EACH_2(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_1(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_3(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_2(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_4(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_3(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_5(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_4(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_6(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_5(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_7(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_6(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_8(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_7(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_9(M, T, f, ...)                             \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_8(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_10(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_9(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_11(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_10(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_12(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_11(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_13(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_12(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_14(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_13(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_15(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_14(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_16(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_15(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_17(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_16(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_18(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_17(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_19(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_18(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_20(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_19(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_21(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_20(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_22(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_21(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_23(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_22(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_24(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_23(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_25(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_24(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_26(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_25(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_27(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_26(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_28(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_27(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_29(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_28(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_30(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_29(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_31(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_30(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_32(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_31(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_33(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_32(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_34(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_33(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_35(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_34(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_36(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_35(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_37(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_36(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_38(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_37(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_39(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_38(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_40(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_39(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_41(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_40(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_42(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_41(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_43(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_42(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_44(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_43(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_45(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_44(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_46(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_45(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_47(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_46(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_48(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_47(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_49(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_48(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_50(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_49(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_51(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_50(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_52(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_51(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_53(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_52(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_54(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_53(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_55(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_54(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_56(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_55(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_57(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_56(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_58(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_57(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_59(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_58(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_60(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_59(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_61(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_60(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_62(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_61(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_63(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_62(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_64(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_63(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_65(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_64(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_66(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_65(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_67(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_66(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_68(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_67(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_69(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_68(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_70(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_69(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_71(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_70(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_72(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_71(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_73(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_72(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_74(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_73(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_75(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_74(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_76(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_75(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_77(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_76(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_78(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_77(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_79(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_78(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_80(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_79(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_81(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_80(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_82(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_81(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_83(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_82(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_84(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_83(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_85(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_84(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_86(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_85(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_87(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_86(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_88(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_87(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_89(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_88(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_90(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_89(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_91(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_90(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_92(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_91(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_93(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_92(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_94(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_93(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_95(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_94(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_96(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_95(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_97(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_96(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_98(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_97(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_99(M, T, f, ...)                            \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_98(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_100(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_99(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_101(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_100(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_102(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_101(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_103(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_102(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_104(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_103(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_105(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_104(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_106(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_105(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_107(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_106(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_108(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_107(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_109(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_108(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_110(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_109(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_111(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_110(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_112(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_111(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_113(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_112(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_114(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_113(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_115(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_114(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_116(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_115(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_117(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_116(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_118(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_117(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_119(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_118(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_120(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_119(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_121(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_120(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_122(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_121(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_123(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_122(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_124(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_123(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_125(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_124(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_126(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_125(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_127(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_126(M, T, __VA_ARGS__))
+#define TR_DETAIL_REFLECT_FOR_EACH_128(M, T, f, ...)                           \
+    M(T, f), TR_DETAIL_REFLECT_EXPAND(                                         \
+                 TR_DETAIL_REFLECT_FOR_EACH_127(M, T, __VA_ARGS__))
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <tr/fwd/tuple_iterator.h>
+
+#include <tr/detail/type_traits.h>
+#include <tr/macros.h>
+#include <tr/simd.h>
+#include <tr/unpack.h>
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+namespace detail {
+
+/// @brief Get the operation to apply to whole vectors, when folding elements
+/// of type `T` with `Op`: either the callable wrapped by `lanewise`, or the
+/// transparent counterpart of a standard arithmetic or bitwise function
+/// object (only for integral elements, as reordering a floating-point fold
+/// would change its result). `type` is `void` for any other callable.
+template <typename Op, typename T, typename = void>
+struct simd_op {
+    using type = void;
+};
+
+template <typename F, typename T>
+struct simd_op<lanewise_t<F>, T> {
+    using type = F;
+
+    static constexpr auto get(lanewise_t<F> const &op) noexcept
+        -> F const & {
+        return op.func();
+    }
+};
+
+template <template <typename> typename StdOp, typename T>
+struct std_simd_op {
+    using type = StdOp<void>;
+
+    template <typename Op>
+    static constexpr auto get(Op const &) noexcept -> type {
+        return {};
+    }
+};
+
+#define TR_STD_SIMD_OP(STD_OP)                                                 \
+    template <typename U, typename T>                                          \
+    struct simd_op<STD_OP<U>, T,                                               \
+                   std::enable_if_t<std::is_integral_v<T> &&                   \
+                                    (std::is_void_v<U> ||                      \
+                                     std::is_same_v<U, T>)>>                   \
+        : std_simd_op<STD_OP, T> {}
+
+TR_STD_SIMD_OP(std::plus);
+TR_STD_SIMD_OP(std::multiplies);
+TR_STD_SIMD_OP(std::bit_and);
+TR_STD_SIMD_OP(std::bit_or);
+TR_STD_SIMD_OP(std::bit_xor);
+
+#undef TR_STD_SIMD_OP
+
+struct element_count_probe {
+    template <typename... Elems>
+    auto operator()(Elems &&...) const
+        -> std::integral_constant<std::size_t, sizeof...(Elems)>;
+};
+
+/// @brief The number of elements of a tuple-like object of type `T`.
+template <typename T>
+static constexpr std::size_t element_count_v{
+    decltype(unpack(std::declval<T &>(), element_count_probe{}))::value};
+
+#if TR_HAS_SIMD
+
+/// @brief Check whether the call happens during constant evaluation, where
+/// the SIMD kernels can't be used.
+TR_ALWAYS_INLINE constexpr auto is_constant_evaluated() noexcept -> bool {
+    return __builtin_is_constant_evaluated();
+}
+
+// The size of the widest vector register for the target, in bytes.
+#if defined(__AVX512F__)
+static constexpr std::size_t simd_register_size{64};
+#elif defined(__AVX__)
+static constexpr std::size_t simd_register_size{32};
+#else
+static constexpr std::size_t simd_register_size{16};
+#endif
+
+/// @brief A vector of `Size` bytes holding elements of type `T`.
+template <typename T, std::size_t Size = simd_register_size>
+struct simd_vec {
+    static constexpr std::size_t lanes{Size / sizeof(T)};
+
+    typedef T type __attribute__((vector_size(Size)));
+
+    [[nodiscard]] TR_ALWAYS_INLINE static auto load(void const *src) noexcept
+        -> type {
+        type v;
+        __builtin_memcpy(&v, src, sizeof(v));
+        return v;
+    }
+
+    TR_ALWAYS_INLINE static void store(type const &v, void *dst) noexcept {
+        __builtin_memcpy(dst, &v, sizeof(v));
+    }
+};
+
+/// @brief Combine the lanes of `v` with `op`, by halving the vector until it
+/// fits in 16 bytes, and then one lane after the other.
+template <typename Vec, typename Op>
+TR_ALWAYS_INLINE auto simd_reduce_lanes(Vec const &v, Op const &op) {
+    using lane_t = remove_cvref_t<decltype(v[0])>;
+    constexpr std::size_t size{sizeof(Vec)};
+
+    if constexpr (size > 16) {
+        using half_t = simd_vec<lane_t, size / 2>;
+        auto const *bytes = reinterpret_cast<unsigned char const *>(&v);
+        return simd_reduce_lanes(
+            op(half_t::load(bytes), half_t::load(bytes + size / 2)), op);
+    } else {
+        lane_t res = v[0];
+        for (std::size_t i{1}; i != size / sizeof(lane_t); ++i) {
+            res = op(res, v[i]);
+        }
+        return res;
+    }
+}
+
+/// @brief Check whether `N` elements of type `T` fill at least a vector (and
+/// whether `T` may be an element of a vector at all, unlike `long double`).
+template <typename T, std::size_t N>
+static constexpr bool fills_simd_vec_v{
+    (std::is_integral_v<T> || std::is_same_v<T, float> ||
+     std::is_same_v<T, double>) &&
+    N >= simd_register_size / sizeof(T)};
+
+/// @brief The elements of a tuple-like object, laid out contiguously.
+template <typename T, std::size_t N>
+struct simd_buffer {
+    T data[N];
+};
+
+/// @brief Call `kernel` on a pointer to the elements of `tuple`, laid out
+/// contiguously: contiguous tuple-like objects (e.g. built-in arrays or
+/// `span`s, see `contiguous_impl`) are accessed in place, the elements of
+/// other tuple-like objects are copied into a buffer first.
+template <typename T, typename Tuple, typename Kernel>
+TR_ALWAYS_INLINE auto with_simd_data(Tuple &tuple, Kernel &&kernel)
+    -> decltype(auto) {
+    using contiguous_t = contiguous_impl<std::remove_cv_t<Tuple>>;
+
+    if constexpr (std::is_array_v<Tuple>) {
+        return static_cast<Kernel &&>(kernel)(&tuple[0]);
+    } else if constexpr (is_implemented_v<contiguous_t>) {
+        T const *data = contiguous_t::apply(tuple);
+        return static_cast<Kernel &&>(kernel)(data);
+    } else {
+        auto const buf = unpack(tuple, [](auto const &...elems) {
+            return simd_buffer<T, sizeof...(elems)>{{elems...}};
+        });
+        return static_cast<Kernel &&>(kernel)(buf.data);
+    }
+}
+
+/// @brief Fold the `N` elements at `data` onto `init`: the elements are
+/// combined a vector at a time, then the lanes of the accumulator vector,
+/// then the remaining elements.
+template <std::size_t N, typename T, typename Op>
+auto simd_fold(T init, T const *data, Op const &op) -> T {
+    using vec_t = simd_vec<T>;
+    constexpr std::size_t lanes{vec_t::lanes};
+    constexpr std::size_t whole{N / lanes * lanes};
+
+    auto acc = vec_t::load(data);
+    for (std::size_t i{lanes}; i != whole; i += lanes) {
+        acc = op(acc, vec_t::load(data + i));
+    }
+
+    T res = op(init, simd_reduce_lanes(acc, op));
+    for (std::size_t i{whole}; i != N; ++i) {
+        res = op(res, data[i]);
+    }
+    return res;
+}
+
+/// @brief Check whether `pred` holds for all (if `All` is `true`) or any of
+/// the `N` elements at `data`, a vector at a time.
+template <bool All, std::size_t N, typename T, typename Pred>
+auto simd_test(T const *data, Pred const &pred) -> bool {
+    using vec_t = simd_vec<T>;
+    constexpr std::size_t lanes{vec_t::lanes};
+    constexpr std::size_t whole{N / lanes * lanes};
+
+    auto acc = pred(vec_t::load(data)) != 0;
+    for (std::size_t i{lanes}; i != whole; i += lanes) {
+        auto const mask = pred(vec_t::load(data + i)) != 0;
+        if constexpr (All) {
+            acc &= mask;
+        } else {
+            acc |= mask;
+        }
+    }
+
+    auto const reduced = [&acc] {
+        if constexpr (All) {
+            return simd_reduce_lanes(acc, std::bit_and<>{});
+        } else {
+            return simd_reduce_lanes(acc, std::bit_or<>{});
+        }
+    }();
+    if (static_cast<bool>(reduced) != All) {
+        return !All;
+    }
+    for (std::size_t i{whole}; i != N; ++i) {
+        if (static_cast<bool>(pred(data[i])) != All) {
+            return !All;
+        }
+    }
+    return All;
+}
+
+template <typename Op, typename T, typename = void>
+static constexpr bool is_closed_under_v{false};
+
+/// @brief Check whether `Op` maps two `T`s to a `T`.
+template <typename Op, typename T>
+static constexpr bool is_closed_under_v<
+    Op, T, std::enable_if_t<std::is_same_v<std::invoke_result_t<Op, T, T>, T>>>{
+    true};
+
+template <typename Tuple, typename Init, typename Op, typename = void>
+static constexpr bool is_simd_foldable_v{false};
+
+/// @brief Check whether folding a `Tuple` onto an `Init` with `Op` may be
+/// done a vector at a time, i.e. whether:
+///  * `Tuple` is a homogeneous arithmetic tuple-like object, with enough
+///    elements to fill a vector;
+///  * `Init` has the same type as the elements;
+///  * `Op` is lane-wise, and maps two elements (resp. vectors) to an element
+///    (resp. a vector).
+template <typename Tuple, typename Init, typename Op>
+static constexpr bool is_simd_foldable_v<
+    Tuple, Init, Op,
+    std::enable_if_t<
+        !std::is_void_v<typename simd_op<Op, simd_element_t<Tuple>>::type> &&
+        std::is_same_v<remove_cvref_t<Init>, simd_element_t<Tuple>> &&
+        fills_simd_vec_v<simd_element_t<Tuple>, element_count_v<Tuple>>>>{
+    is_closed_under_v<typename simd_op<Op, simd_element_t<Tuple>>::type const &,
+                      simd_element_t<Tuple>> &&
+    is_closed_under_v<typename simd_op<Op, simd_element_t<Tuple>>::type const &,
+                      typename simd_vec<simd_element_t<Tuple>>::type>};
+
+template <typename Tuple, typename Func, typename = void>
+static constexpr bool is_simd_callable_v{false};
+
+/// @brief Check whether `Func` may be called on the elements of a `Tuple` a
+/// vector at a time, i.e. whether `Func` is wrapped by `lanewise` and
+/// `Tuple` is a homogeneous arithmetic tuple-like object, with enough
+/// elements to fill a vector.
+template <typename Tuple, typename F>
+static constexpr bool is_simd_callable_v<
+    Tuple, lanewise_t<F>, std::enable_if_t<is_simd_tuple_v<Tuple>>>{
+    fills_simd_vec_v<simd_element_t<Tuple>, element_count_v<Tuple>>};
+
+template <typename Tuple, typename Init, typename Combinator>
+auto simd_fold_left(Tuple &tuple, Init &&init, Combinator const &c)
+    -> simd_element_t<std::remove_const_t<Tuple>> {
+    using tuple_t = std::remove_const_t<Tuple>;
+    using elem_t = simd_element_t<tuple_t>;
+    using op_t = simd_op<Combinator, elem_t>;
+    constexpr std::size_t n{element_count_v<tuple_t>};
+
+    auto &&op = op_t::get(c);
+    return with_simd_data<elem_t>(tuple, [&](elem_t const *data) {
+        return simd_fold<n>(static_cast<elem_t>(init), data, op);
+    });
+}
+
+template <bool All, typename Tuple, typename F>
+auto simd_test_tuple(Tuple &tuple, lanewise_t<F> const &pred) -> bool {
+    using tuple_t = std::remove_const_t<Tuple>;
+    using elem_t = simd_element_t<tuple_t>;
+    constexpr std::size_t n{element_count_v<tuple_t>};
+
+    return with_simd_data<elem_t>(tuple, [&](elem_t const *data) {
+        return simd_test<All, n>(data, pred.func());
+    });
+}
+
+#else
+
+constexpr auto is_constant_evaluated() noexcept -> bool { return true; }
+
+template <typename Tuple, typename Init, typename Op>
+static constexpr bool is_simd_foldable_v{false};
+
+template <typename Tuple, typename Func>
+static constexpr bool is_simd_callable_v{false};
+
+// Never called, as the traits above are always `false`.
+template <typename Tuple, typename Init, typename Combinator>
+void simd_fold_left(Tuple &, Init &&, Combinator const &);
+
+template <bool All, typename Tuple, typename Pred>
+void simd_test_tuple(Tuple &, Pred const &);
+
+#endif // TR_HAS_SIMD
+
+} // namespace detail
+} // namespace tr
@@ -35,6 +35,19 @@ struct is_complete<T, void_t<decltype(sizeof(T))>> : std::true_type {};
 template <typename T>
 constexpr static bool is_complete_v{is_complete<T>::value};
 
+/// @brief Check if `T` is a compile-time boolean, i.e. if it derives from
+/// `std::integral_constant<bool, T::value>` (e.g. `value_constant<false>`).
+template <typename T, typename = void>
+struct is_bool_constant : std::false_type {};
+
+template <typename T>
+struct is_bool_constant<
+    T, std::enable_if_t<std::is_same_v<decltype(T::value), bool const>>>
+    : std::is_base_of<std::integral_constant<bool, T::value>, T> {};
+
+template <typename T>
+static constexpr bool is_bool_constant_v{is_bool_constant<T>::value};
+
 template <typename Callable>
 struct validity_checker {
     template <typename... Args>
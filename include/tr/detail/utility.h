@@ -1,6 +1,7 @@
 #pragma once
 
 #include <tr/detail/literal_parser.h>
+#include <tr/macros.h>
 
 #include <type_traits>
 #include <utility>
@@ -8,19 +9,20 @@
 namespace tr {
 namespace detail {
 template <class T, class U>
-[[nodiscard]] constexpr auto &&forward_like(U &&x) noexcept {
+[[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto &&
+forward_like(U &&x) noexcept {
     constexpr bool is_adding_const =
         std::is_const_v<std::remove_reference_t<T>>;
     if constexpr (std::is_lvalue_reference_v<T &&>) {
         if constexpr (is_adding_const)
-            return std::as_const(x);
+            return static_cast<std::remove_reference_t<U> const &>(x);
         else
             return static_cast<U &>(x);
     } else {
         if constexpr (is_adding_const)
-            return std::move(std::as_const(x));
+            return static_cast<std::remove_reference_t<U> const &&>(x);
         else
-            return std::move(x);
+            return static_cast<std::remove_reference_t<U> &&>(x);
     }
 }
 
@@ -33,7 +35,8 @@ template <class T, class U>
 /// @tparam T
 /// @param t The value to forward or materialize.
 template <typename T>
-static constexpr auto lref_or_value(T &&t) -> T {
+TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto lref_or_value(T &&t)
+    -> T {
     return static_cast<T &&>(t);
 }
 
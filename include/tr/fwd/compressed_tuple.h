@@ -0,0 +1,8 @@
+#pragma once
+
+namespace tr {
+
+template <typename...>
+struct compressed_tuple;
+
+} // namespace tr
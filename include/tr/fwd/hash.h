@@ -0,0 +1,8 @@
+#pragma once
+
+namespace tr {
+
+template <typename T = void>
+struct hash;
+
+} // namespace tr
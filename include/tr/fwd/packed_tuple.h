@@ -0,0 +1,8 @@
+#pragma once
+
+namespace tr {
+
+template <typename...>
+struct packed_tuple;
+
+} // namespace tr
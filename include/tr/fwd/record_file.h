@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tr {
+
+/// @brief How the records are laid out in a record file.
+enum class record_layout : std::uint32_t {
+    /// @brief The serialized records, one after the other.
+    rows = 0,
+    /// @brief One column per element of the records, each holding the
+    /// serialized element of every record.
+    columns = 1,
+};
+
+template <typename T, record_layout Layout = record_layout::rows>
+class record_view;
+
+template <typename T, record_layout Layout = record_layout::rows>
+class record_file;
+
+} // namespace tr
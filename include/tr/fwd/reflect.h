@@ -0,0 +1,10 @@
+#pragma once
+
+#include <tr/unimplemented.h>
+
+namespace tr {
+
+template <typename T>
+struct reflection : unimplemented {};
+
+} // namespace tr
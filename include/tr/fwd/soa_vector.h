@@ -0,0 +1,11 @@
+#pragma once
+
+namespace tr {
+
+template <typename... Ts>
+class soa_vector;
+
+template <typename T>
+struct soa_column;
+
+} // namespace tr
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+namespace tr {
+
+template <typename T, std::size_t N>
+struct span;
+
+} // namespace tr
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <tr/unimplemented.h>
+
+namespace tr {
+
+/// @brief Customization point for tuple-like objects whose elements are laid
+/// out contiguously, like an array: `apply(tuple)` returns a pointer to the
+/// first element.
+template <typename, typename = void>
+struct contiguous_impl : unimplemented {
+    template <typename Tuple>
+    static auto apply(Tuple &) = delete;
+};
+
+} // namespace tr
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <tr/unimplemented.h>
+
+#include <cstddef>
+
+namespace tr {
+
+template <typename, typename = void>
+struct visit_at_impl : unimplemented {
+    template <typename Tuple, typename Func>
+    static auto apply(Tuple &&, std::size_t, Func &&) = delete;
+};
+
+/// @brief Apply a `Func` to the element of a tuple-like object whose index is
+/// only known at runtime.
+struct visit_at_t {
+    template <typename Tuple, typename Func>
+    constexpr auto operator()(Tuple &&, std::size_t, Func &&) const
+        -> decltype(auto);
+};
+
+static constexpr visit_at_t visit_at{};
+
+} // namespace tr
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <tr/fwd/hash.h>
+
+#include <tr/fwd/unpack.h>
+
+#include <tr/detail/type_traits.h>
+#include <tr/macros.h>
+#include <tr/serialize.h>
+#include <tr/tuple_protocol/built_in_array.h>
+#include <tr/tuple_protocol/std_pair.h>
+#include <tr/tuple_protocol/std_tuple.h>
+#include <tr/unimplemented.h>
+#include <tr/unpack.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+static constexpr std::uint64_t hash_seed{0x9e3779b97f4a7c15};
+static constexpr std::uint64_t hash_multiplier{0xbf58476d1ce4e5b9};
+
+/// @brief Absorb a 64-bit word into the state of a hash.
+TR_ALWAYS_INLINE constexpr auto hash_step(std::uint64_t state,
+                                          std::uint64_t word) noexcept
+    -> std::uint64_t {
+    state = (state ^ word) * hash_multiplier;
+    return state ^ (state >> 32);
+}
+
+/// @brief Mix the state of a hash into its value (the finalizer of
+/// MurmurHash3).
+TR_ALWAYS_INLINE constexpr auto hash_finish(std::uint64_t state) noexcept
+    -> std::uint64_t {
+    state = (state ^ (state >> 33)) * 0xff51afd7ed558ccd;
+    state = (state ^ (state >> 33)) * 0xc4ceb9fe1a85ec53;
+    return state ^ (state >> 33);
+}
+
+/// @brief Read the `Size` bytes at `bytes` (at most 8) as a word.
+template <std::size_t Size>
+TR_ALWAYS_INLINE auto load_hash_word(unsigned char const *bytes) noexcept
+    -> std::uint64_t {
+    std::uint64_t word{};
+    std::memcpy(&word, bytes, Size);
+    return word;
+}
+
+template <typename T>
+constexpr auto has_serial_leaves() noexcept -> bool;
+
+template <typename T, std::size_t... Is>
+constexpr auto has_serial_leaves(std::index_sequence<Is...>) noexcept
+    -> bool {
+    return (true && ... &&
+            detail::has_serial_leaves<serial_element_t<T, Is>>());
+}
+
+/// @brief Check whether `T` is a scalar which can be serialized, or a
+/// tuple-like object made of such scalars only.
+template <typename T>
+constexpr auto has_serial_leaves() noexcept -> bool {
+    if constexpr (is_serial_scalar_v<T>) {
+        return true;
+    } else if constexpr (is_serial_tuple_v<T>) {
+        return detail::has_serial_leaves<T>(
+            std::make_index_sequence<serial_length_v<T>>{});
+    } else {
+        return false;
+    }
+}
+
+/// @brief Check whether the bytes of a `T` may be hashed in a single pass,
+/// instead of its elements: the bytes of a `T` are its scalar elements
+/// (without padding), and equal scalars have equal bytes.
+/// @details The elements must also be laid out in order in the `T` itself,
+/// which `has_serial_layout` checks.
+template <typename T>
+constexpr auto is_bytewise_hashable() noexcept -> bool {
+    if constexpr (std::has_unique_object_representations_v<T> &&
+                  detail::has_serial_leaves<T>()) {
+        return sizeof(T) == detail::serialized_size<T>();
+    } else {
+        return false;
+    }
+}
+
+/// @brief Check whether `t` may be hashed as bytes (see
+/// `is_bytewise_hashable`).
+template <typename T>
+TR_ALWAYS_INLINE auto has_hashable_bytes(T const &t) noexcept -> bool {
+    if constexpr (detail::is_bytewise_hashable<T>()) {
+        auto const *base =
+            reinterpret_cast<unsigned char const *>(std::addressof(t));
+        return detail::has_serial_layout<0>(base, t);
+    } else {
+        return false;
+    }
+}
+
+/// @brief Hash the `Size` bytes at `bytes`, a word at a time (the last word
+/// being padded with zeros).
+template <std::size_t Size>
+TR_ALWAYS_INLINE auto hash_bytes(unsigned char const *bytes) noexcept
+    -> std::uint64_t {
+    std::uint64_t state{hash_seed};
+    for (std::size_t i{}; i != Size / 8; ++i) {
+        state = detail::hash_step(state,
+                                  detail::load_hash_word<8>(bytes + 8 * i));
+    }
+    if constexpr (Size % 8 != 0) {
+        state = detail::hash_step(
+            state, detail::load_hash_word<Size % 8>(bytes + Size / 8 * 8));
+    }
+    return detail::hash_finish(state);
+}
+
+/// @brief Absorb the elements of `t` into the state of a hash, depth-first.
+/// @details Integers, enumerations, pointers and floating-point numbers are
+/// absorbed as a word (with `-0.` hashing as `0.`), tuple-like objects
+/// element by element, and anything else through `std::hash`.
+template <typename T>
+auto hash_fields(std::uint64_t state, T const &t) -> std::uint64_t {
+    if constexpr (std::is_enum_v<T>) {
+        return detail::hash_step(
+            state, static_cast<std::uint64_t>(
+                       static_cast<std::underlying_type_t<T>>(t)));
+    } else if constexpr (std::is_integral_v<T>) {
+        return detail::hash_step(state, static_cast<std::uint64_t>(t));
+    } else if constexpr (std::is_pointer_v<T>) {
+        return detail::hash_step(
+            state, static_cast<std::uint64_t>(
+                       reinterpret_cast<std::uintptr_t>(t)));
+    } else if constexpr (std::is_same_v<T, float> ||
+                         std::is_same_v<T, double>) {
+        if (t == T{}) {
+            return detail::hash_step(state, std::uint64_t{});
+        }
+        using uint_t = typename uint_of_size<sizeof(T)>::type;
+        uint_t bits;
+        std::memcpy(&bits, &t, sizeof(T));
+        return detail::hash_step(state, static_cast<std::uint64_t>(bits));
+    } else if constexpr (is_implemented_v<unpack_impl<T>>) {
+        unpack(t, [&state](auto const &...elems) {
+            ((state = detail::hash_fields(state, elems)), ...);
+        });
+        return state;
+    } else {
+        return detail::hash_step(
+            state, static_cast<std::uint64_t>(std::hash<T>{}(t)));
+    }
+}
+
+template <typename T>
+auto hash_value(T const &t) -> std::size_t {
+    if constexpr (detail::is_bytewise_hashable<T>()) {
+        if (detail::has_hashable_bytes(t)) {
+            return static_cast<std::size_t>(detail::hash_bytes<sizeof(T)>(
+                reinterpret_cast<unsigned char const *>(std::addressof(t))));
+        }
+    }
+    return static_cast<std::size_t>(
+        detail::hash_finish(detail::hash_fields(hash_seed, t)));
+}
+
+} // namespace detail
+
+/// @brief A hash function for tuple-like objects, e.g. to use tuples as keys
+/// of unordered containers:
+///
+/// @code
+/// std::unordered_map<tr::tuple<int, int>, float, tr::hash<>> grid;
+/// @endcode
+///
+/// @details `hash<T>` hashes a `tuple`, a `std::pair`, a `std::tuple`, a
+/// built-in array, or any tuple-like object (implementing `at` and `length`,
+/// or `unpack`), as well as the scalars and the types `std::hash` supports.
+///
+/// If the bytes of the object are exactly its scalar elements, in order and
+/// without padding (e.g. `tuple<int, int>` or `std::uint32_t[4]`, see
+/// `std::has_unique_object_representations`), they're hashed in a single
+/// pass, a word at a time. Otherwise, the elements are hashed one after the
+/// other, recursively. Either way, objects whose elements are equal hash the
+/// same, but the hashes aren't meant to be stable across types, platforms or
+/// versions of `tr`: don't persist them.
+/// @tparam T The type of the objects to hash, or `void` to hash objects of
+/// any type.
+template <typename T>
+struct hash {
+    [[nodiscard]] auto operator()(T const &t) const -> std::size_t {
+        return detail::hash_value(t);
+    }
+};
+
+template <>
+struct hash<void> {
+    template <typename T>
+    [[nodiscard]] auto operator()(T const &t) const -> std::size_t {
+        return detail::hash_value(t);
+    }
+};
+
+/// @brief Hash `count` objects at `first`, storing `hash<T>{}(first[i])`
+/// into `out[i]`.
+///
+/// @details Whether the objects are hashed as bytes (see `hash`) is decided
+/// once for the whole batch, so the loop is only made of the hashes
+/// themselves. They're independent from each other: the processor overlaps
+/// consecutive hashes, and the loop runs at the throughput of the
+/// multiplications rather than at their latency.
+template <typename T>
+void hash_batch(T const *first, std::size_t count, std::size_t *out) {
+    if constexpr (detail::is_bytewise_hashable<T>()) {
+        if (count != 0 && detail::has_hashable_bytes(*first)) {
+            auto const *bytes = reinterpret_cast<unsigned char const *>(first);
+            for (std::size_t i{}; i != count; ++i) {
+                out[i] = static_cast<std::size_t>(
+                    detail::hash_bytes<sizeof(T)>(bytes + i * sizeof(T)));
+            }
+            return;
+        }
+    }
+
+    for (std::size_t i{}; i != count; ++i) {
+        out[i] = detail::hash_value(first[i]);
+    }
+}
+
+} // namespace tr
@@ -3,6 +3,7 @@
 #include <tr/fwd/length.h>
 
 #include <tr/detail/type_traits.h>
+#include <tr/macros.h>
 #include <tr/value_constant.h>
 
 #include <utility>
@@ -10,16 +11,17 @@
 namespace tr {
 
 template <typename Sized>
-[[nodiscard]] constexpr decltype(auto)
+[[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr decltype(auto)
 length_t::operator()(Sized &&sized) const {
     using sized_t = detail::remove_cvref_t<Sized>;
-    return length_impl<sized_t>::apply(std::forward<Sized>(sized));
+    return length_impl<sized_t>::apply(static_cast<Sized &&>(sized));
 }
 
 template <typename T, std::size_t N>
 struct length_impl<T[N]> {
     template <typename Sized>
-    [[nodiscard]] constexpr static value_constant<N> apply(Sized &&) noexcept {
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr static auto
+    apply(Sized &&) noexcept -> value_constant<N> {
         return {};
     }
 };
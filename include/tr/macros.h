@@ -11,3 +11,68 @@
 #define TR_EMPTY_BASES /*empty*/
 
 #endif // defined(_MSC_VER)
+
+// Detect the `__type_pack_element` builtin (Clang, GCC 14+).
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define TR_HAS_TYPE_PACK_ELEMENT 1
+#endif
+#endif
+
+#if !defined(TR_HAS_TYPE_PACK_ELEMENT)
+#define TR_HAS_TYPE_PACK_ELEMENT 0
+#endif
+
+// Forwarding shims (e.g. `at`, `get`, `ebo::value`) are marked with
+// `TR_ALWAYS_INLINE TR_ARTIFICIAL`, so that they cost nothing in unoptimized
+// builds and debuggers step over them.
+#if defined(_MSC_VER)
+#define TR_ALWAYS_INLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define TR_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+#define TR_ALWAYS_INLINE inline
+#endif // defined(_MSC_VER)
+
+#if defined(__has_attribute)
+#if __has_attribute(artificial)
+#define TR_ARTIFICIAL __attribute__((artificial))
+#endif
+#endif
+
+#if !defined(TR_ARTIFICIAL)
+#define TR_ARTIFICIAL /*empty*/
+#endif
+
+// The SIMD kernels used by the algorithms on homogeneous arithmetic tuples
+// (see <tr/simd.h>) are built upon GCC-style vector extensions, and are only
+// taken outside of constant evaluation. Define `TR_HAS_SIMD` to 0 to always
+// take the generic path.
+#if !defined(TR_HAS_SIMD)
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define TR_HAS_SIMD 1
+#endif
+#endif
+#endif
+
+#if !defined(TR_HAS_SIMD)
+#define TR_HAS_SIMD 0
+#endif
+
+// Whether the target stores scalars in little-endian byte order, as the
+// serialized layout of <tr/serialize.h> does. MSVC only targets
+// little-endian platforms.
+#if !defined(TR_LITTLE_ENDIAN)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define TR_LITTLE_ENDIAN 1
+#else
+#define TR_LITTLE_ENDIAN 0
+#endif
+#elif defined(_MSC_VER)
+#define TR_LITTLE_ENDIAN 1
+#else
+#define TR_LITTLE_ENDIAN 0
+#endif
+#endif
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/indices_for.h>
+#include <tr/tuple.h>
+
+#include <cstddef>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+template <typename Tuple, std::size_t... Is>
+constexpr auto materialize_impl(Tuple &&t, std::index_sequence<Is...>)
+    -> tuple<remove_cvref_t<decltype(at_c<Is>(std::declval<Tuple>()))>...> {
+    return {at_c<Is>(static_cast<Tuple &&>(t))...};
+}
+
+} // namespace detail
+
+struct materialize_t {
+    /// @brief Copy (or move) the elements of a tuple-like object (e.g. a view)
+    /// into a new `tuple`.
+    /// @details Each element of the result is initialized directly from
+    /// `at(tuple, i)`: if it's a prvalue (e.g. the result of a
+    /// `transform_view`), the copy is elided, and the element is constructed
+    /// in place.
+    /// @param tuple The tuple-like object.
+    /// @return A `tuple` of the (decayed) elements of `tuple`.
+    template <typename Tuple>
+    [[nodiscard]] constexpr auto operator()(Tuple &&tuple) const {
+        return detail::materialize_impl(static_cast<Tuple &&>(tuple),
+                                        indices_for(tuple));
+    }
+};
+
+static constexpr materialize_t materialize{};
+
+template <typename Tuple>
+[[nodiscard]] constexpr auto operator|(Tuple &&tuple, materialize_t m) {
+    return m(static_cast<Tuple &&>(tuple));
+}
+
+} // namespace tr
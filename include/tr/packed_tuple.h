@@ -0,0 +1,206 @@
+#pragma once
+
+#include <tr/fwd/packed_tuple.h>
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+
+#include <tr/detail/index_array.h>
+#include <tr/detail/nth_type.h>
+#include <tr/detail/type_traits.h>
+#include <tr/detail/utility.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol.h>
+#include <tr/type_pack.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief The alignment of the storage that `tup_elem` uses to hold a `T`
+/// (references are stored as pointers).
+/// @tparam T The type of a tuple element.
+template <typename T>
+static constexpr std::size_t storage_alignment_v{
+    alignof(std::conditional_t<std::is_reference_v<T>,
+                               std::remove_reference_t<T> *, T>)};
+
+/// @brief Compute the order in which the tuple elements are laid out in
+/// memory so that padding is minimized.
+///
+/// @details Elements are sorted by decreasing alignment. As the size of a type
+/// is a multiple of its alignment, every element then starts at an offset that
+/// is already suitably aligned and padding is only (possibly) needed at the
+/// end of the object. The sort is stable: elements with the same alignment
+/// keep their declaration order.
+///
+/// @tparam ...Aligns The alignment of each element, in declaration order.
+/// @return The permutation mapping storage positions to logical indices.
+template <std::size_t... Aligns>
+[[nodiscard]] constexpr auto packed_order_for() noexcept {
+    constexpr std::size_t count{sizeof...(Aligns)};
+    std::size_t const aligns[]{Aligns..., 0};
+
+    index_array<count> order{};
+    for (std::size_t i{}; i != count; ++i) {
+        std::size_t j{i};
+        for (; j != 0 && aligns[order.Idx_[j - 1]] < aligns[i]; --j) {
+            order.Idx_[j] = order.Idx_[j - 1];
+        }
+        order.Idx_[j] = i;
+    }
+
+    return order;
+}
+
+template <typename TL, typename IL = void>
+struct packed_storage;
+
+/// @brief Select the storage layout of a `packed_tuple<Ts...>`.
+///
+/// @details The storage is a `tuple_base` whose `tup_elem` bases appear in
+/// storage order, but each one is still tagged with its logical index. This
+/// way, `operator[]` keeps working with logical indices.
+///
+/// @tparam ...Ts The types stored by the tuple, in declaration order.
+template <typename... Ts>
+struct packed_storage<type_pack<Ts...>, void>
+    : packed_storage<type_pack<Ts...>, std::index_sequence_for<Ts...>> {};
+
+template <typename... Ts, std::size_t... Is>
+struct packed_storage<type_pack<Ts...>, std::index_sequence<Is...>> {
+  private:
+    static constexpr auto order{packed_order_for<storage_alignment_v<Ts>...>()};
+
+    template <std::size_t I>
+    using nth_t = nth_type_t<I, Ts...>;
+
+  public:
+    using index_sequence_t = std::index_sequence<order.Idx_[Is]...>;
+    using type =
+        tuple_base<type_pack<nth_t<order.Idx_[Is]>...>, index_sequence_t>;
+};
+
+/// @brief Tag type to select the private constructor of `packed_tuple`.
+struct packed_init_t {};
+
+} // namespace detail
+
+/// @brief A fixed-size collection of (possibly) heterogeneous values whose
+/// elements are laid out in memory so as to minimize padding.
+///
+/// @details `packed_tuple` behaves like `tuple` (elements are accessed by
+/// their declaration index), but its storage order is sorted by decreasing
+/// alignment:
+///
+/// @code
+/// static_assert(sizeof(tr::tuple<char, double, char, int>) == 24);
+/// static_assert(sizeof(tr::packed_tuple<char, double, char, int>) == 16);
+/// @endcode
+///
+/// As the storage order differs from the declaration order, `packed_tuple` is
+/// not an aggregate: it has a constructor that takes its arguments in
+/// declaration order.
+///
+/// @tparam ...Ts The types stored by the tuple (can be empty).
+template <typename... Ts>
+struct packed_tuple : detail::packed_storage<type_pack<Ts...>>::type {
+  private:
+    using storage_t = detail::packed_storage<type_pack<Ts...>>;
+    using base_t = typename storage_t::type;
+    using storage_sequence_t = typename storage_t::index_sequence_t;
+
+    template <typename... Us>
+    static constexpr bool is_element_wise_v{
+        sizeof...(Us) == sizeof...(Ts) && sizeof...(Ts) != 0 &&
+        (!std::is_same_v<detail::remove_cvref_t<Us>, packed_tuple> && ...)};
+
+    template <typename Args, std::size_t... Ps>
+    constexpr packed_tuple(detail::packed_init_t, Args &&args,
+                           std::index_sequence<Ps...>)
+        : base_t{static_cast<Args &&>(args)[zuic<Ps>]...} {}
+
+  public:
+    using base_t::operator=;
+
+    /// @brief Default constructor.
+    constexpr packed_tuple() = default;
+
+    /// @brief Construct each element from a copy of the corresponding
+    /// argument.
+    /// @details This overload allows initializing elements from braced lists.
+    /// @param ...args The arguments, in declaration order.
+    template <typename Dummy = void,
+              typename = std::enable_if_t<sizeof...(Ts) != 0, Dummy>>
+    constexpr packed_tuple(Ts const &...args)
+        : packed_tuple(detail::packed_init_t{},
+                       tr::forward_as_tuple(args...), storage_sequence_t{}) {}
+
+    /// @brief Construct each element from the corresponding argument.
+    /// @param ...args The arguments, in declaration order.
+    template <typename... Us,
+              typename = std::enable_if_t<is_element_wise_v<Us...>>>
+    constexpr packed_tuple(Us &&...args)
+        : packed_tuple(detail::packed_init_t{},
+                       tr::forward_as_tuple(static_cast<Us &&>(args)...),
+                       storage_sequence_t{}) {}
+};
+
+template <typename... Ts>
+packed_tuple(Ts const &...) -> packed_tuple<Ts...>;
+
+/// @brief Swap two packed tuples of the same type.
+///
+/// @param lhs The left-hand-side tuple.
+/// @param rhs The right-hand-side tuple.
+template <typename... Ts>
+constexpr auto swap(packed_tuple<Ts...> &lhs,
+                    packed_tuple<Ts...> &rhs) noexcept(noexcept(lhs.swap(rhs)))
+    -> decltype(lhs.swap(rhs)) {
+    lhs.swap(rhs);
+}
+
+// -- Tuple protocol
+template <typename... Ts>
+struct tup_size<packed_tuple<Ts...>>
+    : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+// --
+
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(packed_tuple<Ts...> const &t) noexcept {
+    return detail::tuple_get<I>(t);
+}
+
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(packed_tuple<Ts...> &t) noexcept {
+    return detail::tuple_get<I>(t);
+}
+
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(packed_tuple<Ts...> &&t) noexcept {
+    return detail::tuple_get<I>(std::move(t));
+}
+
+template <typename... Ts>
+struct at_impl<packed_tuple<Ts...>> : at_impl<tuple<Ts...>> {};
+
+template <typename... Ts>
+struct length_impl<packed_tuple<Ts...>> : length_impl<tuple<Ts...>> {};
+
+} // namespace tr
+
+namespace std {
+
+template <typename... Ts>
+struct tuple_size<::tr::packed_tuple<Ts...>>
+    : integral_constant<size_t, sizeof...(Ts)> {};
+
+template <size_t I, typename... Ts>
+struct tuple_element<I, ::tr::packed_tuple<Ts...>>
+    : tuple_element<I, ::tr::tuple<Ts...>> {};
+} // namespace std
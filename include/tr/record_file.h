@@ -0,0 +1,597 @@
+#pragma once
+
+#include <tr/fwd/record_file.h>
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/macros.h>
+#include <tr/serialize.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/aggregate.h>
+#include <tr/value_constant.h>
+#include <tr/view/view_interface.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Record files are memory-mapped where <sys/mman.h> is available, and read
+// into memory elsewhere.
+#if !defined(TR_HAS_MMAP)
+#if defined(__has_include)
+#if __has_include(<sys/mman.h>)
+#define TR_HAS_MMAP 1
+#endif
+#endif
+#endif
+
+#if !defined(TR_HAS_MMAP)
+#define TR_HAS_MMAP 0
+#endif
+
+#if TR_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace tr {
+
+namespace detail {
+
+/// @brief The header at the beginning of a record file, serialized (see
+/// `serialize`) in its first `record_file_header_size` bytes.
+struct record_file_header {
+    /// @brief "trrecord", read as a little-endian integer.
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t layout;
+    /// @brief A fingerprint of the schema of the records (see
+    /// `record_schema_v`).
+    std::uint64_t schema;
+    std::uint64_t record_size;
+    std::uint64_t record_count;
+};
+
+} // namespace detail
+} // namespace tr
+
+TR_AGGREGATE_TUPLE(tr::detail::record_file_header);
+
+namespace tr {
+namespace detail {
+
+static constexpr std::uint64_t record_file_magic{0x64726f6365727274};
+static constexpr std::uint32_t record_file_version{1};
+static constexpr std::size_t record_file_header_size{64};
+
+constexpr auto fnv1a_step(std::uint64_t hash, std::uint64_t byte) noexcept
+    -> std::uint64_t {
+    return (hash ^ byte) * 0x100000001b3;
+}
+
+template <typename T>
+constexpr auto record_schema(std::uint64_t hash) noexcept -> std::uint64_t;
+
+template <typename T, std::size_t... Is>
+constexpr auto record_schema(std::uint64_t hash,
+                             std::index_sequence<Is...>) noexcept
+    -> std::uint64_t {
+    ((hash = detail::record_schema<serial_element_t<T, Is>>(hash)), ...);
+    return hash;
+}
+
+/// @brief Hash the serialized form of a `T`: the kind and the size of each
+/// scalar, and the nesting of the tuple-like objects (enumerations are
+/// stored as their underlying type).
+template <typename T>
+constexpr auto record_schema(std::uint64_t hash) noexcept -> std::uint64_t {
+    if constexpr (std::is_enum_v<T>) {
+        return detail::record_schema<std::underlying_type_t<T>>(hash);
+    } else if constexpr (is_serial_scalar_v<T>) {
+        constexpr char kind{std::is_same_v<T, bool>         ? 'b'
+                            : std::is_floating_point_v<T>   ? 'f'
+                            : std::is_signed_v<T>           ? 'i'
+                                                            : 'u'};
+        return fnv1a_step(fnv1a_step(hash, kind), sizeof(T));
+    } else {
+        hash = detail::record_schema<T>(
+            fnv1a_step(hash, '('),
+            std::make_index_sequence<serial_length_v<T>>{});
+        return fnv1a_step(hash, ')');
+    }
+}
+
+/// @brief The fingerprint of the schema of a `T`, stored in the header of
+/// record files.
+template <typename T>
+static constexpr std::uint64_t record_schema_v{
+    detail::record_schema<T>(0xcbf29ce484222325)};
+
+template <typename T, std::size_t I>
+static constexpr std::size_t serial_offset_v{
+    detail::serial_offset<T>(std::make_index_sequence<I>{})};
+
+[[noreturn]] inline void throw_record_file_error(int err, char const *what,
+                                                 std::string const &path) {
+    throw std::system_error{err, std::generic_category(),
+                            std::string{"tr::record_file: "} + what + " " +
+                                path};
+}
+
+/// @brief A read-only, memory-mapped file (or a copy of it in memory, where
+/// `mmap` isn't available).
+class mapped_file {
+  public:
+    /// @brief Map the whole file at `path`.
+    /// @throw std::system_error if the file can't be opened or mapped.
+    explicit mapped_file(std::string const &path) {
+#if TR_HAS_MMAP
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            detail::throw_record_file_error(errno, "cannot open", path);
+        }
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            int const err = errno;
+            ::close(fd);
+            detail::throw_record_file_error(err, "cannot stat", path);
+        }
+
+        this->Size_ = static_cast<std::size_t>(st.st_size);
+        if (this->Size_ != 0) {
+            void *addr =
+                ::mmap(nullptr, this->Size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                int const err = errno;
+                ::close(fd);
+                detail::throw_record_file_error(err, "cannot map", path);
+            }
+            this->Data_ = static_cast<std::byte const *>(addr);
+        }
+        ::close(fd);
+#else
+        std::ifstream in{path, std::ios::binary | std::ios::ate};
+        if (!in) {
+            detail::throw_record_file_error(errno, "cannot open", path);
+        }
+
+        this->Size_ = static_cast<std::size_t>(in.tellg());
+        this->Buffer_ = std::make_unique<std::byte[]>(this->Size_);
+        in.seekg(0);
+        if (!in.read(reinterpret_cast<char *>(this->Buffer_.get()),
+                     static_cast<std::streamsize>(this->Size_))) {
+            detail::throw_record_file_error(errno, "cannot read", path);
+        }
+        this->Data_ = this->Buffer_.get();
+#endif
+    }
+
+    mapped_file(mapped_file const &) = delete;
+    auto operator=(mapped_file const &) -> mapped_file & = delete;
+
+    mapped_file(mapped_file &&other) noexcept
+        : Data_{std::exchange(other.Data_, nullptr)},
+          Size_{std::exchange(other.Size_, 0)}
+#if !TR_HAS_MMAP
+          ,
+          Buffer_{std::move(other.Buffer_)}
+#endif
+    {
+    }
+
+    auto operator=(mapped_file &&other) noexcept -> mapped_file & {
+        mapped_file tmp{std::move(other)};
+        std::swap(this->Data_, tmp.Data_);
+        std::swap(this->Size_, tmp.Size_);
+#if !TR_HAS_MMAP
+        std::swap(this->Buffer_, tmp.Buffer_);
+#endif
+        return *this;
+    }
+
+    ~mapped_file() {
+#if TR_HAS_MMAP
+        if (this->Data_ != nullptr) {
+            ::munmap(const_cast<std::byte *>(this->Data_), this->Size_);
+        }
+#endif
+    }
+
+    [[nodiscard]] auto data() const noexcept -> std::byte const * {
+        return this->Data_;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+        return this->Size_;
+    }
+
+  private:
+    std::byte const *Data_{};
+    std::size_t Size_{};
+#if !TR_HAS_MMAP
+    std::unique_ptr<std::byte[]> Buffer_;
+#endif
+};
+
+/// @brief An iterator over the records of a `record_file`.
+///
+/// @details Dereferencing the iterator yields a `record_view`, i.e. a proxy.
+/// Therefore, as far as the C++17 iterator requirements are concerned, this
+/// is only an input iterator.
+template <typename T, record_layout Layout>
+struct record_iterator {
+    using value_type = T;
+    using reference = record_view<T, Layout>;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    std::byte const *Data_;
+    std::size_t Count_;
+    std::size_t Index_;
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        if constexpr (Layout == record_layout::rows) {
+            return reference{this->Data_ +
+                             this->Index_ * serialized_size_v<T>};
+        } else {
+            return reference{this->Data_, this->Count_, this->Index_};
+        }
+    }
+
+    [[nodiscard]] auto operator[](difference_type n) const noexcept
+        -> reference {
+        return *(*this + n);
+    }
+
+    auto operator+=(difference_type n) noexcept -> record_iterator & {
+        this->Index_ += static_cast<std::size_t>(n);
+        return *this;
+    }
+
+    auto operator++() noexcept -> record_iterator & { return *this += 1; }
+
+    auto operator++(int) noexcept -> record_iterator {
+        auto old = *this;
+        ++*this;
+        return old;
+    }
+
+    [[nodiscard]] friend auto operator+(record_iterator it,
+                                        difference_type n) noexcept
+        -> record_iterator {
+        return it += n;
+    }
+
+    [[nodiscard]] friend auto operator-(record_iterator const &lhs,
+                                        record_iterator const &rhs) noexcept
+        -> difference_type {
+        return static_cast<difference_type>(lhs.Index_ - rhs.Index_);
+    }
+
+    [[nodiscard]] friend auto operator==(record_iterator const &lhs,
+                                         record_iterator const &rhs) noexcept
+        -> bool {
+        return lhs.Index_ == rhs.Index_;
+    }
+
+    [[nodiscard]] friend auto operator!=(record_iterator const &lhs,
+                                         record_iterator const &rhs) noexcept
+        -> bool {
+        return lhs.Index_ != rhs.Index_;
+    }
+};
+
+} // namespace detail
+
+/// @brief A lazy view over a record of type `T`, serialized (see
+/// `serialize`) in the rows of a record file.
+///
+/// @details The view is a tuple-like object: `at_c<I>(view)` decodes the
+/// `I`-th element of the record from its serialized bytes (a nested
+/// tuple-like element yields a nested `record_view`), and nothing else is
+/// read. `load()` decodes the whole record.
+/// @tparam T The type of the record.
+/// @ingroup views
+template <typename T>
+class record_view<T, record_layout::rows>
+    : public view_interface<record_view<T, record_layout::rows>> {
+  public:
+    /// @brief Construct from the serialized bytes of a record.
+    constexpr explicit record_view(std::byte const *data) noexcept
+        : Data_{data} {}
+
+    /// @brief Get the serialized bytes of the `I`-th element.
+    template <std::size_t I>
+    [[nodiscard]] TR_ALWAYS_INLINE auto element_data() const noexcept
+        -> std::byte const * {
+        return this->Data_ + detail::serial_offset_v<T, I>;
+    }
+
+    /// @brief Decode the whole record.
+    [[nodiscard]] auto load() const noexcept -> T {
+        return deserialize<T>(this->Data_);
+    }
+
+  private:
+    std::byte const *Data_;
+};
+
+/// @brief A lazy view over a record of type `T`, whose elements are stored
+/// in the columns of a record file: accessing an element only reads its
+/// column.
+/// @tparam T The type of the record.
+/// @ingroup views
+template <typename T>
+class record_view<T, record_layout::columns>
+    : public view_interface<record_view<T, record_layout::columns>> {
+  public:
+    /// @brief Construct from the columns of `count` records, and the index
+    /// of the record.
+    constexpr record_view(std::byte const *data, std::size_t count,
+                          std::size_t index) noexcept
+        : Data_{data}, Count_{count}, Index_{index} {}
+
+    /// @brief Get the serialized bytes of the `I`-th element.
+    template <std::size_t I>
+    [[nodiscard]] TR_ALWAYS_INLINE auto element_data() const noexcept
+        -> std::byte const * {
+        using elem_t = detail::serial_element_t<T, I>;
+        return this->Data_ + this->Count_ * detail::serial_offset_v<T, I> +
+               this->Index_ * serialized_size_v<elem_t>;
+    }
+
+    /// @brief Decode the whole record.
+    [[nodiscard]] auto load() const noexcept -> T {
+        static_assert(std::is_default_constructible_v<T>,
+                      "Only default-constructible objects can be loaded");
+
+        T t;
+        this->load_elements(
+            t, std::make_index_sequence<detail::serial_length_v<T>>{});
+        return t;
+    }
+
+  private:
+    template <std::size_t... Is>
+    void load_elements(T &t, std::index_sequence<Is...>) const noexcept {
+        (detail::deserialize_fields(this->template element_data<Is>(),
+                                    at_c<Is>(t)),
+         ...);
+    }
+
+    std::byte const *Data_;
+    std::size_t Count_;
+    std::size_t Index_;
+};
+
+template <typename T, record_layout Layout>
+struct at_impl<record_view<T, Layout>> {
+    template <typename View, typename Idx>
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL static auto
+    apply(View &&view, Idx) noexcept {
+        static_assert(Idx::value < detail::serial_length_v<T>,
+                      "Index out of bounds");
+        using elem_t = detail::serial_element_t<T, Idx::value>;
+
+        auto const *data = view.template element_data<Idx::value>();
+        if constexpr (detail::is_serial_scalar_v<elem_t>) {
+            return detail::load_scalar<elem_t>(data);
+        } else {
+            return record_view<elem_t>{data};
+        }
+    }
+};
+
+template <typename T, record_layout Layout>
+struct length_impl<record_view<T, Layout>> {
+    template <typename View>
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(View &&) noexcept -> value_constant<detail::serial_length_v<T>> {
+        return {};
+    }
+};
+
+/// @brief A read-only file of records of type `T`, memory-mapped, whose
+/// records are decoded lazily.
+///
+/// @details Opening the file only checks its header: the records are
+/// handed out as `record_view`s, which decode the elements they're asked
+/// for, straight from the mapped pages. With the `columns` layout, a scan
+/// over a few elements of each record only reads their columns.
+///
+/// @code
+/// using row_t = tr::tuple<std::int64_t, double, float, std::uint32_t>;
+/// tr::write_record_file<tr::record_layout::columns>("quotes.rec", rows);
+///
+/// tr::record_file<row_t, tr::record_layout::columns> file{"quotes.rec"};
+/// double sum{};
+/// for (auto row : file)
+///     sum += tr::at_c<1>(row);
+/// @endcode
+///
+/// The file format is:
+///  * a 64-byte header, holding the serialized `record_file_header` (a
+///    magic number, the version of the format, the layout, a fingerprint of
+///    the schema of `T`, the serialized size of a record and the number of
+///    records), padded with zeros;
+///  * with the `rows` layout, the serialized records, one after the other;
+///  * with the `columns` layout, a column per element of `T`, in order: the
+///    `I`-th column holds the serialized `I`-th element of each record, one
+///    after the other.
+/// @tparam T The type of the records: a tuple-like object which can be
+/// serialized (see `serialize`).
+/// @tparam Layout The layout of the records in the file.
+template <typename T, record_layout Layout>
+class record_file {
+    static_assert(serialized_size_v<T> != 0,
+                  "The records must hold at least one scalar");
+
+  public:
+    using value_type = T;
+    using reference = record_view<T, Layout>;
+    using iterator = detail::record_iterator<T, Layout>;
+    using size_type = std::size_t;
+
+    /// @brief Map the record file at `path`.
+    /// @throw std::system_error if the file can't be opened or mapped.
+    /// @throw std::runtime_error if it isn't a record file, or its layout or
+    /// schema don't match.
+    explicit record_file(std::string const &path) : File_{path} {
+        auto const fail = [&path](char const *what) {
+            throw std::runtime_error{std::string{"tr::record_file: "} + path +
+                                     ": " + what};
+        };
+
+        if (this->File_.size() < detail::record_file_header_size) {
+            fail("not a record file");
+        }
+        auto const header =
+            deserialize<detail::record_file_header>(this->File_.data());
+        if (header.magic != detail::record_file_magic) {
+            fail("not a record file");
+        }
+        if (header.version != detail::record_file_version) {
+            fail("unsupported version");
+        }
+        if (header.layout != static_cast<std::uint32_t>(Layout)) {
+            fail("layout mismatch");
+        }
+        if (header.schema != detail::record_schema_v<T> ||
+            header.record_size != serialized_size_v<T>) {
+            fail("schema mismatch");
+        }
+        if ((this->File_.size() - detail::record_file_header_size) /
+                serialized_size_v<T> <
+            header.record_count) {
+            fail("truncated file");
+        }
+        this->Size_ = static_cast<std::size_t>(header.record_count);
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return this->Size_;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return this->Size_ == 0;
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> iterator {
+        return iterator{this->records(), this->Size_, 0};
+    }
+
+    [[nodiscard]] auto end() const noexcept -> iterator {
+        return iterator{this->records(), this->Size_, this->Size_};
+    }
+
+    /// @brief Get a view over the `i`-th record.
+    [[nodiscard]] auto operator[](size_type i) const noexcept -> reference {
+        return this->begin()[static_cast<std::ptrdiff_t>(i)];
+    }
+
+  private:
+    [[nodiscard]] auto records() const noexcept -> std::byte const * {
+        return this->File_.data() + detail::record_file_header_size;
+    }
+
+    detail::mapped_file File_;
+    size_type Size_{};
+};
+
+namespace detail {
+
+struct file_closer {
+    void operator()(std::FILE *file) const noexcept { std::fclose(file); }
+};
+
+template <typename Func, std::size_t... Is>
+void for_each_index(Func &&func, std::index_sequence<Is...>) {
+    (func(value_c<Is>), ...);
+}
+
+} // namespace detail
+
+/// @brief Write `records` into a new record file at `path` (see
+/// `record_file` for the format).
+/// @tparam Layout The layout of the records in the file.
+/// @param records A sized range of tuple-like objects which can be
+/// serialized (see `serialize`), e.g. a `std::vector<tuple<...>>`.
+/// @throw std::system_error if the file can't be written.
+template <record_layout Layout = record_layout::rows, typename Records>
+void write_record_file(std::string const &path, Records const &records) {
+    using record_t = detail::remove_cvref_t<decltype(*std::begin(records))>;
+    static_assert(serialized_size_v<record_t> != 0,
+                  "The records must hold at least one scalar");
+    constexpr std::size_t chunk_size{std::size_t{1} << 16};
+
+    std::unique_ptr<std::FILE, detail::file_closer> file{
+        std::fopen(path.c_str(), "wb")};
+    if (!file) {
+        detail::throw_record_file_error(errno, "cannot create", path);
+    }
+
+    std::vector<std::byte> buf;
+    buf.reserve(chunk_size + serialized_size_v<record_t>);
+    auto const flush = [&] {
+        if (std::fwrite(buf.data(), 1, buf.size(), file.get()) !=
+            buf.size()) {
+            detail::throw_record_file_error(errno, "cannot write", path);
+        }
+        buf.clear();
+    };
+
+    serialize(buf, detail::record_file_header{
+                       detail::record_file_magic,
+                       detail::record_file_version,
+                       static_cast<std::uint32_t>(Layout),
+                       detail::record_schema_v<record_t>,
+                       serialized_size_v<record_t>,
+                       static_cast<std::uint64_t>(std::size(records)),
+                   });
+    buf.resize(detail::record_file_header_size);
+
+    auto const append = [&](auto const &elem) {
+        serialize(buf, elem);
+        if (buf.size() >= chunk_size) {
+            flush();
+        }
+    };
+    if constexpr (Layout == record_layout::rows) {
+        for (auto const &record : records) {
+            append(record);
+        }
+    } else {
+        detail::for_each_index(
+            [&](auto idx) {
+                for (auto const &record : records) {
+                    append(at(record, idx));
+                }
+            },
+            std::make_index_sequence<detail::serial_length_v<record_t>>{});
+    }
+    flush();
+
+    if (std::fclose(file.release()) != 0) {
+        detail::throw_record_file_error(errno, "cannot write", path);
+    }
+}
+
+} // namespace tr
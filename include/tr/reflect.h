@@ -0,0 +1,119 @@
+#pragma once
+
+#include <tr/fwd/reflect.h>
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+
+#include <tr/detail/reflect_macros.h>
+#include <tr/detail/type_traits.h>
+#include <tr/detail/utility.h>
+#include <tr/macros.h>
+#include <tr/span.h>
+#include <tr/tuple.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace tr {
+
+/// @brief Check whether the fields of `T` were registered with `TR_REFLECT`.
+template <typename T>
+static constexpr bool is_reflected_v{
+    is_implemented_v<reflection<detail::remove_cvref_t<T>>>};
+
+/// @brief The number of fields of `T` registered with `TR_REFLECT`.
+template <typename T>
+static constexpr std::size_t field_count_v{
+    std::extent_v<decltype(reflection<detail::remove_cvref_t<T>>::names)>};
+
+/// @brief The name of the `I`-th field of `T` registered with `TR_REFLECT`.
+template <typename T, std::size_t I>
+static constexpr std::string_view field_name_v{
+    reflection<detail::remove_cvref_t<T>>::names[I]};
+
+/// @brief Get the names of the fields of `T` registered with `TR_REFLECT`, in
+/// registration order.
+template <typename T>
+[[nodiscard]] constexpr auto field_names() noexcept
+    -> span<std::string_view const, field_count_v<T>> {
+    return reflection<detail::remove_cvref_t<T>>::names;
+}
+
+/// @brief Implementation of `length` for a type registered with
+/// `TR_REFLECT`.
+template <typename T>
+struct reflected_length_impl {
+    template <typename Sized>
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(Sized &&) noexcept -> value_constant<field_count_v<T>> {
+        return {};
+    }
+};
+
+/// @brief Implementation of `at` for a type registered with `TR_REFLECT`:
+/// the member pointer is a constant, so accessing a field is a load at a
+/// fixed offset.
+template <typename T>
+struct reflected_at_impl {
+    template <typename T_, typename Idx>
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(T_ &&obj, Idx) noexcept -> decltype(auto) {
+        static_assert(Idx{} < field_count_v<T>, "Index out of bounds");
+        constexpr auto member = reflection<T>::members[value_c<Idx::value>];
+        return detail::forward_like<T_>(obj.*member);
+    }
+};
+
+} // namespace tr
+
+#define TR_DETAIL_REFLECT_MEMBER(T, field) &T::field
+#define TR_DETAIL_REFLECT_NAME(T, field) #field
+
+/// @brief Make a class a tuple-like object, whose elements are the given
+/// fields, and record the names of the fields.
+///
+/// @details Unlike `TR_AGGREGATE_TUPLE`, the class doesn't have to be an
+/// aggregate: the fields may be private, inherited, or only some of the
+/// fields of the class. They're registered once, as a table of member
+/// pointers in `tr::reflection<Type>::members`, and `at_c<I>(obj)` applies
+/// the `I`-th one, a compile-time constant. Their names are in
+/// `tr::reflection<Type>::names`, for formatters and serializers (see
+/// `field_names`).
+///
+/// @code
+/// class Order {
+///   public:
+///     ...
+///   private:
+///     friend struct tr::reflection<Order>;
+///
+///     std::uint64_t id_;
+///     double price_;
+/// };
+/// TR_REFLECT(Order, id_, price_);
+///
+/// tr::for_each(order, [](auto const &field) { std::cout << field; });
+/// @endcode
+///
+/// Use it at global scope, with a fully-qualified name (or an alias, for a
+/// name with commas). Private fields are accessible if the class befriends
+/// `tr::reflection<Type>` (declared in <tr/fwd/reflect.h>). Up to 128 fields
+/// may be registered, but neither references nor bit-fields.
+#define TR_REFLECT(Type, ...)                                                  \
+    namespace tr {                                                             \
+    template <>                                                                \
+    struct reflection<Type> {                                                  \
+        static constexpr auto members = tuple{TR_DETAIL_REFLECT_FOR_EACH(      \
+            TR_DETAIL_REFLECT_MEMBER, Type, __VA_ARGS__)};                     \
+        static constexpr std::string_view names[]{TR_DETAIL_REFLECT_FOR_EACH(  \
+            TR_DETAIL_REFLECT_NAME, Type, __VA_ARGS__)};                       \
+    };                                                                         \
+    template <>                                                                \
+    struct length_impl<Type> : reflected_length_impl<Type> {};                 \
+    template <>                                                                \
+    struct at_impl<Type> : reflected_at_impl<Type> {};                         \
+    }                                                                          \
+    static_assert(true, "")
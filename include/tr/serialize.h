@@ -0,0 +1,357 @@
+#pragma once
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/lazy_false.h>
+#include <tr/length.h>
+#include <tr/macros.h>
+#include <tr/unimplemented.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+template <std::size_t Size>
+struct uint_of_size;
+
+template <>
+struct uint_of_size<1> {
+    using type = std::uint8_t;
+};
+
+template <>
+struct uint_of_size<2> {
+    using type = std::uint16_t;
+};
+
+template <>
+struct uint_of_size<4> {
+    using type = std::uint32_t;
+};
+
+template <>
+struct uint_of_size<8> {
+    using type = std::uint64_t;
+};
+
+template <typename T>
+static constexpr bool is_iec559_v{false};
+
+template <>
+inline constexpr bool is_iec559_v<float>{std::numeric_limits<float>::is_iec559};
+
+template <>
+inline constexpr bool is_iec559_v<double>{
+    std::numeric_limits<double>::is_iec559};
+
+/// @brief Check whether `T` is serialized as a single scalar: an integer, an
+/// enumeration, `bool`, or an IEEE-754 `float` or `double`.
+template <typename T>
+static constexpr bool is_serial_scalar_v{
+    (std::is_integral_v<T> || std::is_enum_v<T> || is_iec559_v<T>) &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)};
+
+/// @brief Check whether `T` is serialized field by field, i.e. whether it
+/// implements `at` and `length`.
+template <typename T>
+static constexpr bool is_serial_tuple_v{is_implemented_v<length_impl<T>> &&
+                                        is_implemented_v<at_impl<T>>};
+
+template <typename T>
+static constexpr std::size_t serial_length_v{
+    decltype(length(std::declval<T &>()))::value};
+
+template <typename T, std::size_t I>
+using serial_element_t = remove_cvref_t<decltype(at_c<I>(std::declval<T &>()))>;
+
+template <typename T>
+constexpr auto serialized_size() noexcept -> std::size_t;
+
+template <typename T, std::size_t... Is>
+constexpr auto serialized_size(std::index_sequence<Is...>) noexcept
+    -> std::size_t {
+    return (std::size_t{0} + ... +
+            detail::serialized_size<serial_element_t<T, Is>>());
+}
+
+template <typename T>
+constexpr auto serialized_size() noexcept -> std::size_t {
+    if constexpr (is_serial_scalar_v<T>) {
+        return sizeof(T);
+    } else if constexpr (is_serial_tuple_v<T>) {
+        return detail::serialized_size<T>(
+            std::make_index_sequence<serial_length_v<T>>{});
+    } else {
+        static_assert(lazy_false<T>,
+                      "Only tuple-like objects of integers, enumerations, "
+                      "float and double can be serialized");
+        return 0;
+    }
+}
+
+/// @brief The offset of the `I`-th element in the serialized form of a `T`.
+template <typename T, std::size_t... Js>
+constexpr auto serial_offset(std::index_sequence<Js...>) noexcept
+    -> std::size_t {
+    return (std::size_t{0} + ... +
+            detail::serialized_size<serial_element_t<T, Js>>());
+}
+
+template <typename T>
+constexpr auto has_serial_bool() noexcept -> bool;
+
+template <typename T, std::size_t... Is>
+constexpr auto has_serial_bool(std::index_sequence<Is...>) noexcept -> bool {
+    return (false || ... || detail::has_serial_bool<serial_element_t<T, Is>>());
+}
+
+/// @brief Check whether `T` holds a `bool`, which can't be copied from
+/// arbitrary bytes (only 0 and 1 are valid).
+template <typename T>
+constexpr auto has_serial_bool() noexcept -> bool {
+    if constexpr (is_serial_scalar_v<T>) {
+        return std::is_same_v<T, bool>;
+    } else {
+        return detail::has_serial_bool<T>(
+            std::make_index_sequence<serial_length_v<T>>{});
+    }
+}
+
+/// @brief Check whether a `T` may be serialized with a single `memcpy`, if
+/// its elements are laid out in order (see `has_serial_layout`): `T` is
+/// trivially copyable, without padding, and the target is little-endian.
+template <typename T>
+static constexpr bool is_memcpy_serializable_v{
+    TR_LITTLE_ENDIAN && std::is_trivially_copyable_v<T> &&
+    sizeof(T) == detail::serialized_size<T>() &&
+    !detail::has_serial_bool<T>()};
+
+template <std::size_t Offset, typename T>
+TR_ALWAYS_INLINE auto has_serial_layout(unsigned char const *base,
+                                        T const &t) noexcept -> bool;
+
+template <std::size_t Offset, typename T, std::size_t... Is>
+TR_ALWAYS_INLINE auto has_serial_layout(unsigned char const *base,
+                                        T const &t,
+                                        std::index_sequence<Is...>) noexcept
+    -> bool {
+    return ((std::is_lvalue_reference_v<decltype(at_c<Is>(t))> &&
+             detail::has_serial_layout<
+                 Offset +
+                 detail::serial_offset<T>(std::make_index_sequence<Is>{})>(
+                 base, at_c<Is>(t))) &&
+            ...);
+}
+
+/// @brief Check whether the scalars of `t` are stored in `t` itself, at the
+/// offsets of the serialized layout, relative to `base`.
+/// @details The addresses of the elements are constants relative to `base`,
+/// so the check is folded away by the optimizer.
+template <std::size_t Offset, typename T>
+TR_ALWAYS_INLINE auto has_serial_layout(unsigned char const *base,
+                                        T const &t) noexcept -> bool {
+    if constexpr (is_serial_scalar_v<T>) {
+        return reinterpret_cast<unsigned char const *>(std::addressof(t)) ==
+               base + Offset;
+    } else {
+        return detail::has_serial_layout<Offset>(
+            base, t, std::make_index_sequence<serial_length_v<T>>{});
+    }
+}
+
+/// @brief Write `value` at `out`, in little-endian byte order.
+template <typename T>
+TR_ALWAYS_INLINE void store_scalar(std::byte *out, T value) noexcept {
+    using uint_t = typename uint_of_size<sizeof(T)>::type;
+
+    uint_t bits;
+    if constexpr (std::is_same_v<T, bool>) {
+        bits = value ? 1 : 0;
+    } else {
+        std::memcpy(&bits, &value, sizeof(T));
+    }
+
+    if constexpr (TR_LITTLE_ENDIAN) {
+        std::memcpy(out, &bits, sizeof(T));
+    } else {
+        for (std::size_t i{}; i != sizeof(T); ++i) {
+            out[i] = static_cast<std::byte>(bits >> (8 * i));
+        }
+    }
+}
+
+/// @brief Read a `T` at `in`, in little-endian byte order.
+template <typename T>
+TR_ALWAYS_INLINE auto load_scalar(std::byte const *in) noexcept -> T {
+    using uint_t = typename uint_of_size<sizeof(T)>::type;
+
+    uint_t bits{};
+    if constexpr (TR_LITTLE_ENDIAN) {
+        std::memcpy(&bits, in, sizeof(T));
+    } else {
+        for (std::size_t i{}; i != sizeof(T); ++i) {
+            bits |= static_cast<uint_t>(static_cast<uint_t>(in[i]) << (8 * i));
+        }
+    }
+
+    if constexpr (std::is_same_v<T, bool>) {
+        return bits != 0;
+    } else {
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+}
+
+template <typename T>
+TR_ALWAYS_INLINE void serialize_fields(std::byte *out, T const &t) noexcept;
+
+template <typename T, std::size_t... Is>
+TR_ALWAYS_INLINE void serialize_fields(std::byte *out, T const &t,
+                                       std::index_sequence<Is...>) noexcept {
+    (detail::serialize_fields(
+         out + detail::serial_offset<T>(std::make_index_sequence<Is>{}),
+         at_c<Is>(t)),
+     ...);
+}
+
+/// @brief Write the scalars of `t` one after the other, at constant offsets.
+template <typename T>
+TR_ALWAYS_INLINE void serialize_fields(std::byte *out, T const &t) noexcept {
+    if constexpr (is_serial_scalar_v<T>) {
+        detail::store_scalar(out, t);
+    } else {
+        detail::serialize_fields(
+            out, t, std::make_index_sequence<serial_length_v<T>>{});
+    }
+}
+
+template <typename T>
+TR_ALWAYS_INLINE void deserialize_fields(std::byte const *in,
+                                         T &t) noexcept;
+
+template <typename T, std::size_t... Is>
+TR_ALWAYS_INLINE void deserialize_fields(std::byte const *in, T &t,
+                                         std::index_sequence<Is...>) noexcept {
+    (detail::deserialize_fields(
+         in + detail::serial_offset<T>(std::make_index_sequence<Is>{}),
+         at_c<Is>(t)),
+     ...);
+}
+
+/// @brief Read the scalars of `t` one after the other, at constant offsets.
+template <typename T>
+TR_ALWAYS_INLINE void deserialize_fields(std::byte const *in,
+                                         T &t) noexcept {
+    if constexpr (is_serial_scalar_v<T>) {
+        t = detail::load_scalar<T>(in);
+    } else {
+        detail::deserialize_fields(
+            in, t, std::make_index_sequence<serial_length_v<T>>{});
+    }
+}
+
+} // namespace detail
+
+/// @brief The number of bytes a `T` is serialized into.
+template <typename T>
+static constexpr std::size_t serialized_size_v{
+    detail::serialized_size<detail::remove_cvref_t<T>>()};
+
+/// @brief Write the binary representation of `t` at `out`, and return the
+/// end of the written bytes.
+///
+/// @details `t` is a scalar (an integer, an enumeration, `bool`, `float` or
+/// `double`), or a tuple-like object (implementing `at` and `length`) whose
+/// elements are such scalars or tuple-like objects, e.g. a `tuple`, a
+/// built-in array or an aggregate made tuple-like with `TR_AGGREGATE_TUPLE`.
+/// Its layout is stable across platforms and compilers:
+///  * the scalars are written depth-first in element order, without
+///    padding, for a total of `serialized_size_v<T>` bytes;
+///  * each scalar takes `sizeof` bytes, in little-endian byte order:
+///    integers are two's complement, enumerations are stored as their
+///    underlying type, `bool` as a 0 or 1 byte, and `float` and `double` as
+///    IEEE-754 binary32 and binary64.
+///
+/// When the in-memory representation of `t` is its serialized form (e.g.
+/// `tuple<double, std::int64_t>` on a little-endian target), `t` is copied
+/// with a single `memcpy`. Otherwise, each scalar is written at its offset.
+///
+/// @code
+/// tr::tuple<std::uint32_t, double> quote{42, 1.5};
+///
+/// std::vector<std::byte> buf;
+/// tr::serialize(buf, quote);
+/// auto copy = tr::deserialize<decltype(quote)>(buf.data());
+/// @endcode
+/// @param out The destination, of at least `serialized_size_v<T>` bytes.
+/// @param t The object to serialize.
+template <typename T>
+auto serialize(std::byte *out, T const &t) noexcept -> std::byte * {
+    constexpr std::size_t size{serialized_size_v<T>};
+
+    if constexpr (detail::is_memcpy_serializable_v<T>) {
+        auto const *base = reinterpret_cast<unsigned char const *>(
+            std::addressof(t));
+        if (detail::has_serial_layout<0>(base, t)) {
+            std::memcpy(out, std::addressof(t), size);
+            return out + size;
+        }
+    }
+
+    detail::serialize_fields(out, t);
+    return out + size;
+}
+
+/// @brief Append the binary representation of `t` (see `serialize`) to a
+/// resizable contiguous container of bytes, e.g. a `std::vector<std::byte>`
+/// or a `std::string`.
+template <typename Buffer, typename T,
+          typename = std::enable_if_t<!std::is_pointer_v<Buffer>>>
+void serialize(Buffer &buffer, T const &t) {
+    static_assert(sizeof(*buffer.data()) == 1,
+                  "The buffer must be a container of bytes");
+
+    auto const offset = buffer.size();
+    buffer.resize(offset + serialized_size_v<T>);
+    tr::serialize(reinterpret_cast<std::byte *>(buffer.data()) + offset, t);
+}
+
+/// @brief Read a `T` from its binary representation at `in` (see
+/// `serialize`).
+/// @details `T` must be default-constructible, and its elements assignable
+/// through `at`. The `T` is default-initialized (not value-initialized)
+/// before its elements are read: zeroing it first would only be overwritten,
+/// and stalls the copy of the result on store forwarding.
+/// @param in The source, of at least `serialized_size_v<T>` bytes.
+template <typename T>
+[[nodiscard]] auto deserialize(std::byte const *in) noexcept -> T {
+    static_assert(std::is_default_constructible_v<T>,
+                  "Only default-constructible objects can be deserialized");
+
+    T t;
+    if constexpr (detail::is_memcpy_serializable_v<T>) {
+        auto const *base = reinterpret_cast<unsigned char const *>(
+            std::addressof(t));
+        if (detail::has_serial_layout<0>(base, std::as_const(t))) {
+            std::memcpy(std::addressof(t), in, sizeof(T));
+            return t;
+        }
+    }
+
+    detail::deserialize_fields(in, t);
+    return t;
+}
+
+} // namespace tr
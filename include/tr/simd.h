@@ -0,0 +1,118 @@
+#pragma once
+
+#include <tr/detail/ebo.h>
+#include <tr/detail/nth_type.h>
+#include <tr/detail/type_traits.h>
+#include <tr/is_valid.h>
+#include <tr/unpack.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+struct element_types_probe {
+    template <typename... Elems>
+    auto operator()(Elems &&...) const -> type_list<remove_cvref_t<Elems>...>;
+};
+
+template <typename List, typename = void>
+struct homogeneous_arithmetic {};
+
+template <typename T, typename... Ts>
+struct homogeneous_arithmetic<
+    type_list<T, Ts...>,
+    std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                     (std::is_same_v<T, Ts> && ...)>> {
+    using type = T;
+};
+
+template <typename T, typename = void>
+struct simd_element_impl {};
+
+template <typename T>
+struct simd_element_impl<T,
+                         std::enable_if_t<is_implemented_v<unpack_impl<T>>>>
+    : homogeneous_arithmetic<decltype(unpack(std::declval<T &>(),
+                                             element_types_probe{}))> {};
+
+} // namespace detail
+
+/// @brief Get the type of the elements of a non-empty tuple-like object, if
+/// they all have the same arithmetic type (other than `bool`), e.g.
+/// `tuple<int, int>` or `float[4]`.
+/// @details If `T` is not such a tuple-like object (e.g. a `value_sequence`,
+/// whose elements are all different `value_constant`s), `simd_element<T>` has
+/// no `type` member.
+/// @tparam T The type of the tuple-like object.
+template <typename T>
+struct simd_element : detail::simd_element_impl<T> {};
+
+template <typename T>
+using simd_element_t = typename simd_element<T>::type;
+
+/// @brief Check whether the algorithms may process the elements of a
+/// tuple-like object of type `T` a vector register at a time.
+template <typename T>
+static constexpr bool is_simd_tuple_v{
+    is_valid_type_expr_v<simd_element_t, T>};
+
+/// @brief A callable which applies `F` lane by lane, i.e. `F` can be called
+/// on a vector of elements as well as on each element.
+///
+/// @details Wrapping a callable into `lanewise` lets `fold_left`, `all_of`
+/// and `any_of` call it on whole vector registers, when the elements of the
+/// tuple all have the same arithmetic type:
+///
+/// @code
+/// tr::tuple<float, float, float, float, float, float, float, float> t{...};
+///
+/// auto sum = tr::fold_left(t, 0.f, tr::lanewise(std::plus<>{}));
+/// bool pos = tr::all_of(t, tr::lanewise([](auto x) { return x > 0; }));
+/// @endcode
+///
+/// In exchange, the elements may be visited in any order, and a fold may
+/// combine them in any order: the callable must be free of side effects, and
+/// a binary operator must be associative and commutative (with floating-point
+/// elements, the result may differ from a sequential fold, as when compiling
+/// with `-ffast-math`). Predicates return a vector of masks when called on a
+/// vector (e.g. `x > 0`).
+/// @tparam F The type of the wrapped callable.
+template <typename F>
+struct lanewise_t : private detail::ebo<F, lanewise_t<F>> {
+  private:
+    using base_t = detail::ebo<F, lanewise_t<F>>;
+
+  public:
+    constexpr lanewise_t() = default;
+
+    /// @brief Construct from the callable to wrap.
+    constexpr explicit lanewise_t(F f) noexcept(
+        std::is_nothrow_move_constructible_v<F>)
+        : base_t{static_cast<F &&>(f)} {}
+
+    /// @brief Get the wrapped callable.
+    [[nodiscard]] constexpr auto func() const noexcept -> F const & {
+        return this->value();
+    }
+
+    template <typename... Args>
+    constexpr auto operator()(Args &&...args) const
+        noexcept(noexcept(std::declval<F const &>()(
+            static_cast<Args &&>(args)...)))
+            -> decltype(std::declval<F const &>()(
+                static_cast<Args &&>(args)...)) {
+        return this->value()(static_cast<Args &&>(args)...);
+    }
+};
+
+/// @brief Mark `f` as callable lane by lane (see `lanewise_t`).
+template <typename F>
+[[nodiscard]] constexpr auto lanewise(F f) noexcept(
+    std::is_nothrow_move_constructible_v<F>) -> lanewise_t<F> {
+    return lanewise_t<F>{static_cast<F &&>(f)};
+}
+
+} // namespace tr
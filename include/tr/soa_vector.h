@@ -0,0 +1,482 @@
+#pragma once
+
+#include <tr/fwd/soa_vector.h>
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+
+#include <tr/algorithm/for_each.h>
+#include <tr/tuple.h>
+#include <tr/unpack.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief The alignment of the columns of a `soa_vector`: a (typical) cache
+/// line, or the alignment of `T`, if it's stricter.
+template <typename T>
+static constexpr std::size_t soa_column_alignment_v{
+    alignof(T) > 64 ? alignof(T) : 64};
+
+/// @brief A minimal allocator that returns storage aligned to `Align`.
+/// @tparam T The value type.
+/// @tparam Align The alignment of the allocated storage.
+template <typename T, std::size_t Align>
+struct aligned_allocator {
+    static_assert(Align >= alignof(T), "Align is too small for T");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = aligned_allocator<U, Align>;
+    };
+
+    constexpr aligned_allocator() noexcept = default;
+
+    template <typename U>
+    constexpr aligned_allocator(aligned_allocator<U, Align> const &) noexcept {}
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T * {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return static_cast<T *>(
+            ::operator new(n * sizeof(T), std::align_val_t{Align}));
+    }
+
+    void deallocate(T *ptr, std::size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t{Align});
+    }
+
+    template <typename U>
+    [[nodiscard]] friend constexpr auto
+    operator==(aligned_allocator, aligned_allocator<U, Align>) noexcept
+        -> bool {
+        return true;
+    }
+
+    template <typename U>
+    [[nodiscard]] friend constexpr auto
+    operator!=(aligned_allocator, aligned_allocator<U, Align>) noexcept
+        -> bool {
+        return false;
+    }
+};
+
+/// @brief A random-access iterator over the rows of a `soa_vector`.
+///
+/// @details Dereferencing the iterator yields a `tuple<Ts &...>`, i.e. a
+/// proxy. Therefore, as far as the C++17 iterator requirements are concerned,
+/// this is only an input iterator.
+///
+/// @tparam ...Ts The (possibly const-qualified) column types.
+template <typename... Ts>
+struct soa_iterator {
+    using value_type = tuple<std::remove_const_t<Ts>...>;
+    using reference = tuple<Ts &...>;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    tuple<Ts *...> Ptrs_;
+
+    [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+        return unpack(Ptrs_, [](auto *...ptrs) { return reference{*ptrs...}; });
+    }
+
+    [[nodiscard]] constexpr auto operator[](difference_type n) const noexcept
+        -> reference {
+        return *(*this + n);
+    }
+
+    constexpr auto operator+=(difference_type n) noexcept -> soa_iterator & {
+        for_each(this->Ptrs_, [n](auto *&ptr) { ptr += n; });
+        return *this;
+    }
+
+    constexpr auto operator-=(difference_type n) noexcept -> soa_iterator & {
+        return *this += -n;
+    }
+
+    constexpr auto operator++() noexcept -> soa_iterator & {
+        return *this += 1;
+    }
+
+    constexpr auto operator--() noexcept -> soa_iterator & {
+        return *this -= 1;
+    }
+
+    constexpr auto operator++(int) noexcept -> soa_iterator {
+        auto old = *this;
+        ++*this;
+        return old;
+    }
+
+    constexpr auto operator--(int) noexcept -> soa_iterator {
+        auto old = *this;
+        --*this;
+        return old;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(soa_iterator it,
+                                                  difference_type n) noexcept
+        -> soa_iterator {
+        return it += n;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(difference_type n,
+                                                  soa_iterator it) noexcept
+        -> soa_iterator {
+        return it += n;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(soa_iterator it,
+                                                  difference_type n) noexcept
+        -> soa_iterator {
+        return it -= n;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(soa_iterator const &lhs,
+                                                  soa_iterator const &rhs)
+        -> difference_type {
+        return lhs.front() - rhs.front();
+    }
+
+#define DEFINE_COMPARISON_OPERATOR(OP)                                         \
+    [[nodiscard]] friend constexpr auto operator OP(                           \
+        soa_iterator const &lhs, soa_iterator const &rhs) noexcept->bool {     \
+        return lhs.front() OP rhs.front();                                     \
+    }
+
+    DEFINE_COMPARISON_OPERATOR(==)
+    DEFINE_COMPARISON_OPERATOR(!=)
+    DEFINE_COMPARISON_OPERATOR(<)
+    DEFINE_COMPARISON_OPERATOR(<=)
+    DEFINE_COMPARISON_OPERATOR(>)
+    DEFINE_COMPARISON_OPERATOR(>=)
+
+#undef DEFINE_COMPARISON_OPERATOR
+
+  private:
+    /// @brief All of the pointers move in lockstep: comparing the first one is
+    /// enough.
+    [[nodiscard]] constexpr auto front() const noexcept {
+        return this->Ptrs_[zuic<0>];
+    }
+};
+
+} // namespace detail
+
+/// @brief A non-owning view over one column of a `soa_vector`.
+/// @tparam T The (possibly const-qualified) column type.
+template <typename T>
+struct soa_column {
+    T *Data_;
+    std::size_t Size_;
+
+    [[nodiscard]] constexpr auto data() const noexcept -> T * {
+        return this->Data_;
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+        return this->Size_;
+    }
+
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+        return this->Size_ == 0;
+    }
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> T * {
+        return this->Data_;
+    }
+
+    [[nodiscard]] constexpr auto end() const noexcept -> T * {
+        return this->Data_ + this->Size_;
+    }
+
+    [[nodiscard]] constexpr auto operator[](std::size_t i) const noexcept
+        -> T & {
+        return this->Data_[i];
+    }
+};
+
+/// @brief A structure-of-arrays container: each `Ts` is stored in its own
+/// contiguous, cache-line aligned column.
+///
+/// @details Rows are handed out as tuples of references (like `tie` would
+/// create), so a loop that only touches a few fields only reads the columns it
+/// needs:
+///
+/// @code
+/// tr::soa_vector<int, float, float> v;
+/// v.emplace_back(0, 1.f, 2.f);
+/// v.push_back(tr::tuple{1, 2.f, 3.f});
+///
+/// for (auto [id, x, y] : v) // tr::tuple<int &, float &, float &>
+///     x += y;
+///
+/// float sum{};
+/// for (float y : v.column(tr::zuic<2>))
+///     sum += y;
+/// @endcode
+///
+/// With respect to the tuple protocol, a `soa_vector` is a tuple of columns:
+/// `at(v, zuic<I>)` is the `I`-th `soa_column` and `length(v)` is the number
+/// of columns.
+///
+/// @tparam ...Ts The column types.
+template <typename... Ts>
+class soa_vector {
+    static_assert(sizeof...(Ts) != 0, "A soa_vector needs at least a column");
+
+    static_assert(((std::is_object_v<Ts> && !std::is_array_v<Ts> &&
+                    !std::is_const_v<Ts>)&&...),
+                  "Columns must be non-const, non-array object types");
+
+    static_assert((!std::is_same_v<Ts, bool> && ...),
+                  "std::vector<bool> can't hand out a bool &: use a "
+                  "std::uint8_t (or a wrapper) column instead");
+
+    template <typename T>
+    using column_storage_t =
+        std::vector<T, detail::aligned_allocator<
+                           T, detail::soa_column_alignment_v<T>>>;
+
+    using columns_t = tuple<column_storage_t<Ts>...>;
+    using index_sequence_t = std::index_sequence_for<Ts...>;
+
+  public:
+    using value_type = tuple<Ts...>;
+    using reference = tuple<Ts &...>;
+    using const_reference = tuple<Ts const &...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = detail::soa_iterator<Ts...>;
+    using const_iterator = detail::soa_iterator<Ts const...>;
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return this->Columns_[zuic<0>].size();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return this->size() == 0;
+    }
+
+    [[nodiscard]] auto capacity() const noexcept -> size_type {
+        return this->Columns_[zuic<0>].capacity();
+    }
+
+    void reserve(size_type newCapacity) {
+        for_each(this->Columns_, [newCapacity](auto &column) {
+            column.reserve(newCapacity);
+        });
+    }
+
+    /// @brief Resize all of the columns to `newSize` rows (new elements are
+    /// value-initialized).
+    /// @details If growing any column throws, the columns are shrunk back to
+    /// their previous size.
+    void resize(size_type newSize) {
+        auto const oldSize = this->size();
+        size_type resized{};
+        try {
+            for_each(this->Columns_, [newSize, &resized](auto &column) {
+                column.resize(newSize);
+                ++resized;
+            });
+        } catch (...) {
+            this->shrink_first(resized, oldSize);
+            throw;
+        }
+    }
+
+    void clear() noexcept {
+        for_each(this->Columns_, [](auto &column) { column.clear(); });
+    }
+
+    /// @brief Append a row, constructing each column element from the
+    /// corresponding argument.
+    /// @param ...args The arguments, one per column.
+    /// @return A reference to the new row.
+    template <typename... Args>
+    auto emplace_back(Args &&...args) -> reference {
+        static_assert(sizeof...(Args) == sizeof...(Ts),
+                      "Expected one argument per column");
+
+        if (this->size() != this->capacity()) {
+            return this->emplace_back_impl(index_sequence_t{},
+                                           static_cast<Args &&>(args)...);
+        }
+
+        // The arguments may refer to elements of this vector (e.g.
+        // `v.push_back(v[0])`), which growing the columns frees: build the
+        // row before.
+        value_type row{static_cast<Ts>(static_cast<Args &&>(args))...};
+        this->grow();
+        return unpack(std::move(row), [this](auto &&...elems) {
+            return this->emplace_back_impl(
+                index_sequence_t{}, static_cast<decltype(elems)>(elems)...);
+        });
+    }
+
+    /// @brief Append a row.
+    /// @param row A tuple-like object with one element per column.
+    template <typename Row>
+    void push_back(Row &&row) {
+        unpack(static_cast<Row &&>(row), [this](auto &&...elems) {
+            this->emplace_back(static_cast<decltype(elems)>(elems)...);
+        });
+    }
+
+    void push_back(value_type const &row) {
+        this->push_back<value_type const &>(row);
+    }
+
+    void push_back(value_type &&row) {
+        this->push_back<value_type>(std::move(row));
+    }
+
+    void pop_back() noexcept {
+        for_each(this->Columns_, [](auto &column) { column.pop_back(); });
+    }
+
+    [[nodiscard]] auto operator[](size_type i) noexcept -> reference {
+        return unpack(this->Columns_,
+                      [i](auto &...columns) { return tr::tie(columns[i]...); });
+    }
+
+    [[nodiscard]] auto operator[](size_type i) const noexcept
+        -> const_reference {
+        return unpack(this->Columns_, [i](auto const &...columns) {
+            return tr::tie(columns[i]...);
+        });
+    }
+
+    [[nodiscard]] auto front() noexcept -> reference { return (*this)[0]; }
+
+    [[nodiscard]] auto front() const noexcept -> const_reference {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] auto back() noexcept -> reference {
+        return (*this)[this->size() - 1];
+    }
+
+    [[nodiscard]] auto back() const noexcept -> const_reference {
+        return (*this)[this->size() - 1];
+    }
+
+    /// @brief Get the `I`-th column.
+    /// @return A non-owning view over the column.
+    template <typename Int, Int I>
+    [[nodiscard]] auto column(std::integral_constant<Int, I>) noexcept {
+        auto &storage = this->Columns_[zuic<I>];
+        using column_t = soa_column<std::tuple_element_t<I, value_type>>;
+        return column_t{storage.data(), storage.size()};
+    }
+
+    template <typename Int, Int I>
+    [[nodiscard]] auto column(std::integral_constant<Int, I>) const noexcept {
+        auto const &storage = this->Columns_[zuic<I>];
+        using column_t = soa_column<std::tuple_element_t<I, value_type> const>;
+        return column_t{storage.data(), storage.size()};
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return unpack(this->Columns_, [](auto &...columns) {
+            return iterator{{columns.data()...}};
+        });
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return unpack(this->Columns_, [](auto const &...columns) {
+            return const_iterator{{columns.data()...}};
+        });
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return this->begin() + static_cast<difference_type>(this->size());
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return this->begin() + static_cast<difference_type>(this->size());
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return this->begin();
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return this->end();
+    }
+
+  private:
+    columns_t Columns_;
+
+    /// @brief Make room in all of the columns for at least one more element.
+    /// Then, appending to a column can't reallocate, and only the element
+    /// constructor may throw.
+    void grow() {
+        auto const size = this->size();
+        this->reserve(size == 0 ? 1 : 2 * size);
+    }
+
+    /// @brief Shrink the first `count` columns back to `size` elements.
+    void shrink_first(size_type count, size_type size) noexcept {
+        size_type i{};
+        for_each(this->Columns_, [&](auto &column) {
+            while (i < count && column.size() > size) {
+                column.pop_back();
+            }
+            ++i;
+        });
+    }
+
+    template <std::size_t... Is, typename... Args>
+    auto emplace_back_impl(std::index_sequence<Is...>, Args &&...args)
+        -> reference {
+        auto const oldSize = this->size();
+        size_type emplaced{};
+        try {
+            ((this->Columns_[zuic<Is>].emplace_back(static_cast<Args &&>(args)),
+              ++emplaced),
+             ...);
+        } catch (...) {
+            this->shrink_first(emplaced, oldSize);
+            throw;
+        }
+
+        return this->back();
+    }
+};
+
+template <typename... Ts>
+struct at_impl<soa_vector<Ts...>> {
+    template <typename Soa, typename Idx>
+    [[nodiscard]] static auto apply(Soa &&soa, Idx idx) noexcept {
+        return soa.column(idx);
+    }
+};
+
+template <typename... Ts>
+struct length_impl<soa_vector<Ts...>> {
+    template <typename Soa>
+    [[nodiscard]] static constexpr auto apply(Soa &&) noexcept
+        -> value_constant<sizeof...(Ts)> {
+        return {};
+    }
+};
+
+} // namespace tr
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <tr/fwd/span.h>
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+#include <tr/fwd/tuple_iterator.h>
+
+#include <tr/macros.h>
+#include <tr/value_constant.h>
+#include <tr/view/view_interface.h>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace tr {
+
+/// @brief A non-owning view over `N` contiguous elements of type `T`.
+///
+/// @details A `span` is a tuple-like object: functions taking `N` scalar
+/// arguments can be called on a fixed-size window of a larger buffer without
+/// copying it into a `tuple` first, and the window can be piped into views:
+///
+/// @code
+/// std::vector<float> samples = ...;
+/// for (std::size_t i{}; i + 4 <= samples.size(); ++i) {
+///     tr::span<float const, 4> window{samples.data() + i};
+///     out[i] = tr::unpack(window, [](float a, float b, float c, float d) {
+///         return (a + d) * 0.25f + (b + c) * 0.75f;
+///     });
+/// }
+/// @endcode
+///
+/// The elements are accessed through the pointer: they're l-values whatever
+/// the value category and the constness of the span (use `span<T const, N>`
+/// for read-only access). The span itself is pointer-sized and trivially
+/// copyable.
+/// @tparam T The (possibly const-qualified) type of the elements.
+/// @tparam N The number of elements.
+/// @ingroup views
+template <typename T, std::size_t N>
+struct span : view_interface<span<T, N>> {
+    static_assert(N != 0, "A span needs at least an element");
+    static_assert(std::is_object_v<T> && !std::is_array_v<T>,
+                  "T must be a non-array object type");
+
+  public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+
+    /// @brief Construct from a pointer to the first of `N` elements.
+    constexpr explicit span(T *data) noexcept : Data_{data} {}
+
+    /// @brief Construct from a built-in array of `N` elements.
+    template <typename U, typename = std::enable_if_t<
+                              std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr span(U (&arr)[N]) noexcept : Data_{arr} {}
+
+    /// @brief Construct from a span over less qualified elements (e.g. a
+    /// `span<T const, N>` from a `span<T, N>`).
+    template <typename U, typename = std::enable_if_t<
+                              std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr span(span<U, N> other) noexcept : Data_{other.data()} {}
+
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    data() const noexcept -> T * {
+        return this->Data_;
+    }
+
+    using view_interface<span>::operator[];
+
+    /// @brief Get the `i`-th element.
+    [[nodiscard]] constexpr auto operator[](std::size_t i) const noexcept
+        -> T & {
+        return this->Data_[i];
+    }
+
+    /// @brief Get a span over `Count` elements, starting from `Offset`.
+    template <std::size_t Offset, std::size_t Count = N - Offset>
+    [[nodiscard]] constexpr auto subspan() const noexcept -> span<T, Count> {
+        static_assert(Offset + Count <= N, "Subspan out of bounds");
+        return span<T, Count>{this->Data_ + Offset};
+    }
+
+  private:
+    T *Data_;
+};
+
+template <typename T, std::size_t N>
+span(T (&)[N]) -> span<T, N>;
+
+template <typename T, std::size_t N>
+struct at_impl<span<T, N>> {
+    template <typename Span, typename Idx>
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(Span &&s, Idx) noexcept -> T & {
+        static_assert(Idx{} < N, "Index out of bounds");
+        return s.data()[Idx{}];
+    }
+};
+
+template <typename T, std::size_t N>
+struct length_impl<span<T, N>> {
+    template <typename Span>
+    [[nodiscard]] static constexpr auto apply(Span &&) noexcept
+        -> value_constant<N> {
+        return {};
+    }
+};
+
+template <typename T, std::size_t N>
+struct contiguous_impl<span<T, N>> {
+    template <typename Span>
+    [[nodiscard]] static constexpr auto apply(Span &s) noexcept -> T * {
+        return s.data();
+    }
+};
+
+} // namespace tr
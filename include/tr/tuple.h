@@ -8,12 +8,12 @@
 
 #include <tr/detail/ebo.h>
 #include <tr/detail/flat_array.h>
+#include <tr/detail/nth_type.h>
 #include <tr/detail/tuple_traits_utils.h>
 #include <tr/detail/type_traits.h>
 #include <tr/is_valid.h>
 #include <tr/macros.h>
 #include <tr/tuple_protocol.h>
-#include <tr/type_identity.h>
 #include <tr/type_pack.h>
 
 #include <cstddef>
@@ -220,7 +220,7 @@ struct tup_elem : tup_elem_base<T, I> {
     }
 
     template <typename Int>
-    [[nodiscard]] constexpr auto
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
     operator[](std::integral_constant<Int, I>) const &noexcept
         //-> decltype(std::declval<base_t const &>().value()) {
         -> decltype(auto) {
@@ -228,7 +228,7 @@ struct tup_elem : tup_elem_base<T, I> {
     }
 
     template <typename Int>
-    [[nodiscard]] constexpr auto
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
     operator[](std::integral_constant<Int, I>) &noexcept
         //-> decltype(std::declval<base_t &>().value()) {
         -> decltype(auto) {
@@ -236,7 +236,7 @@ struct tup_elem : tup_elem_base<T, I> {
     }
 
     template <typename Int>
-    [[nodiscard]] constexpr auto
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
     operator[](std::integral_constant<Int, I>) const &&noexcept
         //-> decltype(std::declval<base_t const &&>().value()) {
         -> decltype(auto) {
@@ -244,21 +244,12 @@ struct tup_elem : tup_elem_base<T, I> {
     }
 
     template <typename Int>
-    [[nodiscard]] constexpr auto
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
     operator[](std::integral_constant<Int, I>) &&noexcept
         //-> decltype(std::declval<base_t &&>().value()) {
         -> decltype(auto) {
         return std::move(*this).value();
     }
-
-    /// @brief An undefined member function to query the type of this
-    /// tup_elem in traits like std::tuple_element.
-    ///
-    /// @return `type_identity<T>`. If I return `T` directly, I can't
-    /// use this technique to query the type of a `tup_elem<T[N]>`, as
-    /// I can't return arrays.
-    static type_identity<T>
-        get_type(std::integral_constant<std::size_t, I>) /* undefined */;
 };
 
 template <typename... Ts, std::size_t... Is>
@@ -303,7 +294,6 @@ struct TR_EMPTY_BASES tuple_base<type_pack<Ts...>, std::index_sequence<Is...>>
 
   public:
     using tup_elem<Ts, Is>::operator[]...;
-    using tup_elem<Ts, Is>::get_type...;
 
     /// @brief Copy assignment operator (enabled if there's a mismatch between
     /// the `Us...` and the `Ts...`).
@@ -509,6 +499,54 @@ template <typename... Us>
 auto swap(tuple<Us...> &lhs, tuple<Us...> &rhs) -> std::enable_if_t<
     !detail::tuple_swappable_with_v<decltype(lhs), decltype(rhs)>> = delete;
 
+namespace detail {
+
+/// @brief Compare two elements of tuples: built-in arrays element by element,
+/// anything else with `==`.
+template <typename T, typename U>
+constexpr auto tuple_elements_equal(T const &lhs, U const &rhs) -> bool {
+    if constexpr (std::is_array_v<T>) {
+        static_assert(std::extent_v<T> == std::extent_v<U>,
+                      "Arrays of different sizes");
+        for (std::size_t i{}; i != std::extent_v<T>; ++i) {
+            if (!detail::tuple_elements_equal(lhs[i], rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    } else {
+        return lhs == rhs;
+    }
+}
+
+template <typename Lhs, typename Rhs, std::size_t... Is>
+constexpr auto tuples_equal(Lhs const &lhs, Rhs const &rhs,
+                            std::index_sequence<Is...>) -> bool {
+    return (detail::tuple_elements_equal(lhs[zuic<Is>], rhs[zuic<Is>]) &&
+            ...);
+}
+
+} // namespace detail
+
+/// @brief Compare two tuples of the same size element by element, from the
+/// first one to the last one (like `std::tuple`).
+///
+/// @param lhs The left-hand-side tuple.
+/// @param rhs The right-hand-side tuple.
+template <typename... Ts, typename... Us>
+[[nodiscard]] constexpr auto operator==(tuple<Ts...> const &lhs,
+                                        tuple<Us...> const &rhs)
+    -> std::enable_if_t<sizeof...(Ts) == sizeof...(Us), bool> {
+    return detail::tuples_equal(lhs, rhs, std::index_sequence_for<Ts...>{});
+}
+
+template <typename... Ts, typename... Us>
+[[nodiscard]] constexpr auto operator!=(tuple<Ts...> const &lhs,
+                                        tuple<Us...> const &rhs)
+    -> std::enable_if_t<sizeof...(Ts) == sizeof...(Us), bool> {
+    return !(lhs == rhs);
+}
+
 /// @brief Creates a `tuple` of l-value references to its arguments. This is
 /// analogous to `std::tie`.
 /// @param ...args Any number of l-value arguments to construct the `tuple`.
@@ -555,41 +593,47 @@ struct tup_size<tuple<Ts...>>
 
 namespace detail {
 template <std::size_t I, typename Tuple>
-constexpr decltype(auto) tuple_get(Tuple &&t) noexcept {
+TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr decltype(auto)
+tuple_get(Tuple &&t) noexcept {
     using tuple_t = remove_cvref_t<Tuple>;
     static_assert(I < tup_size_v<tuple_t>, "Index out of range");
-    return std::forward<Tuple>(t)[zuic<I>];
+    return static_cast<Tuple &&>(t)[zuic<I>];
 }
 } // namespace detail
 
 template <std::size_t I, typename... Ts>
-constexpr decltype(auto) get(tuple<Ts...> const &t) noexcept {
+TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr decltype(auto)
+get(tuple<Ts...> const &t) noexcept {
     return detail::tuple_get<I>(t);
 }
 
 template <std::size_t I, typename... Ts>
-constexpr decltype(auto) get(tuple<Ts...> &t) noexcept {
+TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr decltype(auto)
+get(tuple<Ts...> &t) noexcept {
     return detail::tuple_get<I>(t);
 }
 
 template <std::size_t I, typename... Ts>
-constexpr decltype(auto) get(tuple<Ts...> &&t) noexcept {
-    return detail::tuple_get<I>(std::move(t));
+TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr decltype(auto)
+get(tuple<Ts...> &&t) noexcept {
+    return detail::tuple_get<I>(static_cast<tuple<Ts...> &&>(t));
 }
 
 template <typename... Ts>
 struct at_impl<tuple<Ts...>> {
     template <typename Iterable, typename Idx>
-    static constexpr decltype(auto) apply(Iterable &&tuple, Idx) noexcept {
+    TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr decltype(auto)
+    apply(Iterable &&tuple, Idx) noexcept {
         using idx_t = std::integral_constant<std::size_t, Idx::value>;
-        return std::forward<Iterable>(tuple)[idx_t{}];
+        return static_cast<Iterable &&>(tuple)[idx_t{}];
     }
 };
 
 template <typename... Ts>
 struct length_impl<tuple<Ts...>> {
     template <typename Iterable>
-    static constexpr auto apply(Iterable &&) noexcept
+    TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(Iterable &&) noexcept
         -> value_constant<sizeof...(Ts)> {
         return {};
     }
@@ -610,6 +654,8 @@ struct tuple_size<::tr::tuple<Ts...>>
     : integral_constant<size_t, sizeof...(Ts)> {};
 
 template <size_t I, typename... Ts>
-struct tuple_element<I, ::tr::tuple<Ts...>>
-    : decltype(::tr::tuple<Ts...>::get_type(::tr::zuic<I>)) {};
+struct tuple_element<I, ::tr::tuple<Ts...>> {
+    static_assert(I < sizeof...(Ts), "Index out of range");
+    using type = ::tr::detail::nth_type_t<I, Ts...>;
+};
 } // namespace std
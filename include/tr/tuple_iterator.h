@@ -0,0 +1,281 @@
+#pragma once
+
+#include <tr/fwd/tuple_iterator.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/is_valid.h>
+#include <tr/length.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+template <typename T, std::size_t N>
+struct contiguous_impl<T[N]> {
+    template <typename Arr>
+    [[nodiscard]] static constexpr auto apply(Arr &arr) noexcept {
+        return &arr[0];
+    }
+};
+
+namespace detail {
+
+template <typename Tuple, std::size_t I>
+using element_reference_t = decltype(at(std::declval<Tuple &>(), value_c<I>));
+
+template <typename T, T Val>
+auto constant_value_type(std::integral_constant<T, Val> const &)
+    -> T /* unimplemented */;
+
+template <typename Elem>
+using constant_value_type_t =
+    decltype(detail::constant_value_type(std::declval<Elem>()));
+
+/// @brief The values of a sequence of `integral_constant`s, as an array.
+template <typename T, typename... Elems>
+struct constant_array {
+    static constexpr T values[]{remove_cvref_t<Elems>::value...};
+};
+
+/// @brief A table with a function per element of a `Tuple`, which returns
+/// that element: it maps a runtime index to an element.
+template <typename Tuple, typename Reference, std::size_t... Is>
+struct jump_table {
+    template <std::size_t I>
+    [[nodiscard]] static constexpr auto at_index(Tuple &tuple) -> Reference {
+        return at(tuple, value_c<I>);
+    }
+
+    static constexpr Reference (*table[])(Tuple &){&at_index<Is>...};
+};
+
+/// @brief A random-access iterator over the elements of a tuple-like object,
+/// which all have the same type.
+///
+/// @details The iterator holds the address of the tuple and an index, which
+/// is mapped to an element through a `jump_table`. If the elements are
+/// accessed by value (e.g. through a `transform_view`), dereferencing the
+/// iterator yields a prvalue: as far as the C++17 iterator requirements are
+/// concerned, this is then only an input iterator.
+///
+/// @tparam Tuple The (possibly const-qualified) type of the tuple-like object.
+/// @tparam Reference The type of its elements, as returned by `at`.
+/// @tparam Is The indices of its elements.
+template <typename Tuple, typename Reference, std::size_t... Is>
+struct tuple_iterator {
+    using value_type = remove_cvref_t<Reference>;
+    using reference = Reference;
+    using pointer = std::conditional_t<std::is_reference_v<Reference>,
+                                       std::remove_reference_t<Reference> *,
+                                       void>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::conditional_t<std::is_reference_v<Reference>,
+                           std::random_access_iterator_tag,
+                           std::input_iterator_tag>;
+
+    Tuple *Tuple_;
+    difference_type Idx_;
+
+    [[nodiscard]] constexpr auto operator*() const -> reference {
+        using table_t = jump_table<Tuple, Reference, Is...>;
+        return table_t::table[this->Idx_](*this->Tuple_);
+    }
+
+    [[nodiscard]] constexpr auto operator[](difference_type n) const
+        -> reference {
+        return *(*this + n);
+    }
+
+    constexpr auto operator+=(difference_type n) noexcept -> tuple_iterator & {
+        this->Idx_ += n;
+        return *this;
+    }
+
+    constexpr auto operator-=(difference_type n) noexcept -> tuple_iterator & {
+        return *this += -n;
+    }
+
+    constexpr auto operator++() noexcept -> tuple_iterator & {
+        return *this += 1;
+    }
+
+    constexpr auto operator--() noexcept -> tuple_iterator & {
+        return *this -= 1;
+    }
+
+    constexpr auto operator++(int) noexcept -> tuple_iterator {
+        auto old = *this;
+        ++*this;
+        return old;
+    }
+
+    constexpr auto operator--(int) noexcept -> tuple_iterator {
+        auto old = *this;
+        --*this;
+        return old;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(tuple_iterator it,
+                                                  difference_type n) noexcept
+        -> tuple_iterator {
+        return it += n;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(difference_type n,
+                                                  tuple_iterator it) noexcept
+        -> tuple_iterator {
+        return it += n;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(tuple_iterator it,
+                                                  difference_type n) noexcept
+        -> tuple_iterator {
+        return it -= n;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(tuple_iterator const &lhs,
+                                                  tuple_iterator const &rhs)
+        -> difference_type {
+        return lhs.Idx_ - rhs.Idx_;
+    }
+
+#define DEFINE_COMPARISON_OPERATOR(OP)                                         \
+    [[nodiscard]] friend constexpr auto operator OP(                           \
+        tuple_iterator const &lhs, tuple_iterator const &rhs) noexcept->bool { \
+        return lhs.Idx_ OP rhs.Idx_;                                           \
+    }
+
+    DEFINE_COMPARISON_OPERATOR(==)
+    DEFINE_COMPARISON_OPERATOR(!=)
+    DEFINE_COMPARISON_OPERATOR(<)
+    DEFINE_COMPARISON_OPERATOR(<=)
+    DEFINE_COMPARISON_OPERATOR(>)
+    DEFINE_COMPARISON_OPERATOR(>=)
+
+#undef DEFINE_COMPARISON_OPERATOR
+};
+
+template <typename Tuple, typename IdxPack, typename = void>
+struct constant_elements : std::false_type {};
+
+/// @brief Check whether the elements of a `Tuple` are all
+/// `integral_constant`s with the same value type.
+template <typename Tuple, std::size_t I0, std::size_t... Is>
+struct constant_elements<
+    Tuple, std::index_sequence<I0, Is...>,
+    std::enable_if_t<
+        are_same_v<constant_value_type_t<element_reference_t<Tuple, I0>>,
+                   constant_value_type_t<element_reference_t<Tuple, Is>>...>>>
+    : std::true_type {
+    using values_t =
+        constant_array<constant_value_type_t<element_reference_t<Tuple, I0>>,
+                       element_reference_t<Tuple, I0>,
+                       element_reference_t<Tuple, Is>...>;
+};
+
+/// @brief Get an iterator to the first element of `tuple`:
+///  * a pointer to the elements, if they're laid out contiguously (see
+///    `contiguous_impl`);
+///  * a `tuple_iterator`, if `at` returns the same type for all of them;
+///  * a pointer into an array of their values, if they're all
+///    `integral_constant`s with the same value type (e.g. the elements of a
+///    `value_sequence`).
+///
+/// Other tuple-like objects aren't ranges: the result type is then `void`.
+template <typename Tuple, std::size_t... Is>
+constexpr auto tuple_begin_impl(Tuple &tuple,
+                                std::index_sequence<Is...> indices) noexcept {
+    using tuple_t = std::remove_cv_t<Tuple>;
+    using constants_t = constant_elements<Tuple, decltype(indices)>;
+
+    if constexpr (sizeof...(Is) == 0) {
+        return;
+    } else if constexpr (is_implemented_v<contiguous_impl<tuple_t>>) {
+        return contiguous_impl<tuple_t>::apply(tuple);
+    } else if constexpr (are_same_v<element_reference_t<Tuple, Is>...>) {
+        using reference_t = element_reference_t<Tuple, 0>;
+        return tuple_iterator<Tuple, reference_t, Is...>{&tuple, 0};
+    } else if constexpr (constants_t::value) {
+        return &constants_t::values_t::values[0];
+    }
+}
+
+template <typename Tuple>
+using tuple_indices_t =
+    std::make_index_sequence<decltype(length(std::declval<Tuple &>()))::value>;
+
+template <typename Tuple>
+using tuple_begin_t = decltype(detail::tuple_begin_impl(
+    std::declval<Tuple &>(), tuple_indices_t<Tuple>{}));
+
+template <typename Tuple, typename = void>
+static constexpr bool is_tuple_range_v{false};
+
+/// @brief Check whether a tuple-like object of type `Tuple` may be iterated
+/// over (see `tuple_begin_impl`).
+template <typename Tuple>
+static constexpr bool is_tuple_range_v<
+    Tuple, std::enable_if_t<
+               is_implemented_v<at_impl<std::remove_cv_t<Tuple>>> &&
+               is_implemented_v<length_impl<std::remove_cv_t<Tuple>>>>>{
+    !std::is_void_v<tuple_begin_t<Tuple>>};
+
+template <typename Tuple>
+[[nodiscard]] constexpr auto tuple_begin(Tuple &tuple) noexcept {
+    return detail::tuple_begin_impl(tuple, tuple_indices_t<Tuple>{});
+}
+
+template <typename Tuple>
+[[nodiscard]] constexpr auto tuple_end(Tuple &tuple) noexcept {
+    return detail::tuple_begin(tuple) +
+           static_cast<std::ptrdiff_t>(tuple_indices_t<Tuple>::size());
+}
+
+template <typename T>
+using member_begin_t = decltype(std::declval<T &>().begin());
+
+} // namespace detail
+
+/// @brief Get an iterator to the first element of a tuple-like object whose
+/// elements all have the same type, e.g. a `tuple<int, int, int>` or a
+/// `value_sequence<int, 1, 2, 3>`.
+///
+/// @details Together with `end`, this makes such tuples ranges (views are
+/// ranges through their `begin` and `end` members):
+///
+/// @code
+/// tr::tuple<double, double, double> t{1., 2., 3.};
+/// double sum = std::accumulate(begin(t), end(t), 0.);
+/// for (double &x : t)
+///     x *= 2;
+/// @endcode
+///
+/// Built-in arrays and index views over consecutive elements of an array are
+/// contiguous: their iterators are pointers. A `tuple` isn't: its elements
+/// are distinct subobjects, visited through a table mapping an index to each
+/// element (see `detail::tuple_iterator`).
+template <typename Tuple,
+          typename = std::enable_if_t<
+              detail::is_tuple_range_v<Tuple> && !std::is_array_v<Tuple> &&
+              !is_valid_type_expr_v<detail::member_begin_t, Tuple>>>
+[[nodiscard]] constexpr auto begin(Tuple &tuple) noexcept {
+    return detail::tuple_begin(tuple);
+}
+
+/// @brief Get an iterator past the last element of a tuple-like object whose
+/// elements all have the same type (see `begin`).
+template <typename Tuple,
+          typename = std::enable_if_t<
+              detail::is_tuple_range_v<Tuple> && !std::is_array_v<Tuple> &&
+              !is_valid_type_expr_v<detail::member_begin_t, Tuple>>>
+[[nodiscard]] constexpr auto end(Tuple &tuple) noexcept {
+    return detail::tuple_end(tuple);
+}
+
+} // namespace tr
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+#include <tr/fwd/unpack.h>
+
+#include <tr/detail/aggregate_fields.h>
+#include <tr/detail/nth_type.h>
+#include <tr/macros.h>
+#include <tr/tuple.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief A type that converts to the type of any field of `Aggregate` (but
+/// not to `Aggregate` itself, which would be copy-initialized instead).
+template <typename Aggregate, std::size_t I>
+struct any_field {
+    template <typename T,
+              typename = std::enable_if_t<!std::is_same_v<T, Aggregate>>>
+    constexpr operator T() const noexcept /* undefined */;
+};
+
+template <typename Aggregate, typename IdxPack, typename = void>
+static constexpr bool is_brace_initializable_v{false};
+
+template <typename Aggregate, std::size_t... Is>
+static constexpr bool is_brace_initializable_v<
+    Aggregate, std::index_sequence<Is...>,
+    std::void_t<decltype(Aggregate{any_field<Aggregate, Is>{}...})>>{true};
+
+/// @brief Find the largest number of initializers, up to `N`, an `Aggregate`
+/// may be brace-initialized from.
+template <typename Aggregate, std::size_t N>
+constexpr auto aggregate_field_count() noexcept -> std::size_t {
+    if constexpr (N == 0 ||
+                  is_brace_initializable_v<Aggregate,
+                                           std::make_index_sequence<N>>) {
+        return N;
+    } else {
+        return detail::aggregate_field_count<Aggregate, N - 1>();
+    }
+}
+
+/// @brief The number of fields of an `Aggregate`: each field takes at least
+/// a byte, unless the aggregate is empty.
+template <typename Aggregate>
+static constexpr std::size_t aggregate_field_count_v{
+    detail::aggregate_field_count<Aggregate,
+                                  (sizeof(Aggregate) < aggregate_max_fields
+                                       ? sizeof(Aggregate)
+                                       : aggregate_max_fields)>()};
+
+/// @brief Select the `I`-th argument.
+template <std::size_t I>
+struct nth_arg_t {
+    template <typename... Args>
+    TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+    operator()(Args &&...args) const noexcept -> nth_type_t<I, Args &&...> {
+        tuple<std::remove_reference_t<Args> *...> const ptrs{
+            std::addressof(args)...};
+        return static_cast<nth_type_t<I, Args &&...>>(*ptrs[value_c<I>]);
+    }
+};
+
+} // namespace detail
+
+/// @brief The number of fields of `Aggregate`, as seen by the tuple protocol.
+template <typename Aggregate>
+static constexpr std::size_t aggregate_size_v{
+    detail::aggregate_field_count_v<Aggregate>};
+
+/// @brief Implementation of `length` for an aggregate (see
+/// `TR_AGGREGATE_TUPLE`).
+template <typename Aggregate>
+struct aggregate_length_impl {
+    static_assert(std::is_aggregate_v<Aggregate>,
+                  "Only aggregates can be used as tuples this way");
+
+    template <typename Sized>
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(Sized &&) noexcept -> value_constant<aggregate_size_v<Aggregate>> {
+        return {};
+    }
+};
+
+/// @brief Implementation of `unpack` for an aggregate: the fields are bound
+/// to names with a single structured binding, and passed to the function.
+template <typename Aggregate>
+struct aggregate_unpack_impl {
+    static_assert(std::is_aggregate_v<Aggregate>,
+                  "Only aggregates can be used as tuples this way");
+
+    template <typename Aggregate_, typename Func>
+    TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(Aggregate_ &&aggregate, Func &&func) -> decltype(auto) {
+        using fields_t = detail::aggregate_fields<aggregate_size_v<Aggregate>>;
+        return fields_t::unpack(static_cast<Aggregate_ &&>(aggregate),
+                                static_cast<Func &&>(func));
+    }
+};
+
+/// @brief Implementation of `at` for an aggregate.
+template <typename Aggregate>
+struct aggregate_at_impl {
+    template <typename Aggregate_, typename Idx>
+    [[nodiscard]] TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply(Aggregate_ &&aggregate, Idx) noexcept -> decltype(auto) {
+        static_assert(Idx{} < aggregate_size_v<Aggregate>,
+                      "Index out of bounds");
+        return aggregate_unpack_impl<Aggregate>::apply(
+            static_cast<Aggregate_ &&>(aggregate), detail::nth_arg_t<Idx{}>{});
+    }
+};
+
+} // namespace tr
+
+/// @brief Make an aggregate (e.g. a plain struct) a tuple-like object, whose
+/// elements are its fields, in declaration order.
+///
+/// @details The number of fields is found by brace-initializing the aggregate
+/// with more and more arguments, and the fields are accessed through a
+/// structured binding: with optimizations on, `at_c<I>(row)` is a plain load
+/// of the `I`-th field, and `unpack(row, f)` passes the fields to `f`
+/// directly.
+///
+/// @code
+/// struct DBRow {
+///     int id;
+///     std::string name;
+/// };
+/// TR_AGGREGATE_TUPLE(DBRow);
+///
+/// tr::for_each(row, [](auto const &field) { std::cout << field; });
+/// @endcode
+///
+/// Use it at global scope, with a fully-qualified name. The aggregate may
+/// have up to 128 fields, and no base classes, reference fields nor
+/// built-in array fields.
+#define TR_AGGREGATE_TUPLE(...)                                                \
+    namespace tr {                                                             \
+    template <>                                                                \
+    struct length_impl<__VA_ARGS__> : aggregate_length_impl<__VA_ARGS__> {};   \
+    template <>                                                                \
+    struct at_impl<__VA_ARGS__> : aggregate_at_impl<__VA_ARGS__> {};           \
+    template <>                                                                \
+    struct unpack_impl<__VA_ARGS__> : aggregate_unpack_impl<__VA_ARGS__> {};   \
+    }                                                                          \
+    static_assert(true, "")
@@ -3,6 +3,7 @@
 #include "../fwd/at.h"
 #include "../fwd/length.h"
 
+#include "../detail/nth_type.h"
 #include "../tuple_protocol.h"
 #include "../value_constant.h"
 
@@ -13,12 +14,14 @@ namespace tr {
 
 template <typename T, T... Is>
 struct at_impl<std::integer_sequence<T, Is...>> {
+  private:
+    using values_t = detail::value_array<T, Is...>;
 
+  public:
     template <typename Iterable, typename Idx>
     static constexpr auto apply(Iterable &&, Idx) noexcept -> decltype(auto) {
         static_assert(Idx{} < sizeof...(Is), "Index out of bounds");
-        constexpr T is[]{Is...};
-        return value_c<is[Idx{}]>;
+        return value_c<values_t::values[Idx{}]>;
     }
 };
 
@@ -40,8 +43,8 @@ struct tup_size<std::integer_sequence<T, Is...>>
 template <std::size_t J, typename T, T... Is>
 [[nodiscard]] constexpr auto get(std::integer_sequence<T, Is...>) noexcept {
     static_assert(J < sizeof...(Is), "Index out of bounds");
-    constexpr std::size_t indices[]{Is...};
-    return value_c<indices[J]>;
+    using values_t = detail::value_array<std::size_t, Is...>;
+    return value_c<values_t::values[J]>;
 }
 // --
 
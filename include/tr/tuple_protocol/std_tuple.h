@@ -1,11 +1,34 @@
 #pragma once
 
+#include "../fwd/at.h"
+#include "../fwd/length.h"
+
 #include "../tuple_protocol.h"
 
 #include <tuple>
 #include <utility>
 
 namespace tr {
+
+template <typename... Ts>
+struct length_impl<std::tuple<Ts...>> {
+    template <typename Tuple>
+    [[nodiscard]] constexpr static auto apply(Tuple &&) noexcept
+        -> value_constant<sizeof...(Ts)> {
+        return {};
+    }
+};
+
+template <typename... Ts>
+struct at_impl<std::tuple<Ts...>> {
+
+    template <typename Tuple, typename Idx>
+    [[nodiscard]] constexpr static auto apply(Tuple &&tuple, Idx) noexcept
+        -> decltype(auto) {
+        return std::get<Idx{}>(std::forward<Tuple>(tuple));
+    }
+};
+
 template <typename... Ts>
 struct tup_size<std::tuple<Ts...>> : std::tuple_size<std::tuple<Ts...>> {};
 
@@ -6,6 +6,7 @@
 #include <tr/detail/type_traits.h>
 #include <tr/indices_for.h>
 #include <tr/length.h>
+#include <tr/macros.h>
 
 #include <type_traits>
 #include <utility>
@@ -13,11 +14,11 @@
 namespace tr {
 
 template <typename Tuple, typename Func>
-constexpr auto unpack_impl_t::operator()(Tuple &&t, Func &&f) const
-    -> decltype(auto) {
+TR_ALWAYS_INLINE TR_ARTIFICIAL constexpr auto
+unpack_impl_t::operator()(Tuple &&t, Func &&f) const -> decltype(auto) {
     using tuple_t = detail::remove_cvref_t<Tuple>;
-    return unpack_impl<tuple_t>::apply(std::forward<Tuple>(t),
-                                       std::forward<Func>(f));
+    return unpack_impl<tuple_t>::apply(static_cast<Tuple &&>(t),
+                                       static_cast<Func &&>(f));
 }
 
 template <typename Tuple>
@@ -26,16 +27,18 @@ struct unpack_impl<Tuple,
                                     is_implemented_v<length_impl<Tuple>>>> {
 
     template <typename Tuple_, typename Func, std::size_t... Is>
-    static constexpr auto apply_impl(Tuple_ &&t, Func &&f,
-                                     std::index_sequence<Is...>)
+    TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto
+    apply_impl(Tuple_ &&t, Func &&f, std::index_sequence<Is...>)
         -> decltype(auto) {
-        return std::forward<Func>(f)(at_c<Is>(std::forward<Tuple_>(t))...);
+        return static_cast<Func &&>(f)(at_c<Is>(static_cast<Tuple_ &&>(t))...);
     }
 
     template <typename Tuple_, typename Func>
-    static constexpr auto apply(Tuple_ &&t, Func &&f) -> decltype(auto) {
-        return unpack_impl::apply_impl(std::forward<Tuple_>(t),
-                                       std::forward<Func>(f), indices_for(t));
+    TR_ALWAYS_INLINE TR_ARTIFICIAL static constexpr auto apply(Tuple_ &&t,
+                                                               Func &&f)
+        -> decltype(auto) {
+        return unpack_impl::apply_impl(static_cast<Tuple_ &&>(t),
+                                       static_cast<Func &&>(f), indices_for(t));
     }
 };
 
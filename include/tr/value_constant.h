@@ -12,9 +12,12 @@ template <typename T, T Val>
 struct integral_constant : std::integral_constant<T, Val> {
 
     /// @brief Explicit cast to the wrapped value.
-    /// @tparam U The type to cast to (different from the wrapped value type).
+    /// @tparam U The type to cast to (different from the wrapped value type,
+    /// and constructible from it).
     /// @return The wrapped value.
-    template <typename U, typename = std::enable_if_t<!std::is_same_v<U, T>>>
+    template <typename U,
+              typename = std::enable_if_t<!std::is_same_v<U, T> &&
+                                          std::is_constructible_v<U, T>>>
     [[nodiscard]] constexpr explicit operator U() const noexcept {
         return U{Val};
         //     ^ prevent narrowing conversions (on explicit casts).
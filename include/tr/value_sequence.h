@@ -1,5 +1,9 @@
 #pragma once
 
+#include <tr/fwd/at.h>
+#include <tr/fwd/length.h>
+
+#include <tr/detail/nth_type.h>
 #include <tr/detail/type_traits.h>
 #include <tr/detail/utility.h>
 #include <tr/value_constant.h>
@@ -22,34 +26,52 @@ struct from_any {
     /* implicit */ constexpr from_any(T&&) noexcept /* undefined */;
 };
 
-template <std::size_t I, auto Val>
-struct value_sequence_elem {
-    template <typename T>
+template <typename T, auto... Vals>
+struct value_sequence_impl {
+    static_assert(
+        are_same_v<T, detail::from_any> || are_same_v<T, decltype(Vals)...>,
+        "This instanciation is neither a value tuple nor a value array.");
+
+  private:
+    using values_t = value_list<Vals...>;
+
+  public:
+    template <typename Int, Int I,
+              typename = std::enable_if_t<(static_cast<std::size_t>(I) <
+                                           sizeof...(Vals))>>
     [[nodiscard]] constexpr auto
-    operator[](std::integral_constant<T, I>) const noexcept
-        -> value_constant<Val> {
+    operator[](std::integral_constant<Int, I>) const noexcept
+        -> value_constant<values_t::template nth_value<I>> {
         return {};
     }
 };
+} // namespace detail
 
-template <typename T, typename IdxPack, auto... Vals>
-struct value_sequence_impl;
-
-template <typename T, std::size_t... Is, auto... Vals>
-struct value_sequence_impl<T, std::index_sequence<Is...>, Vals...>
-    : value_sequence_elem<Is, Vals>... {
-    static_assert(
-        are_same_v<T, detail::from_any> || are_same_v<T, decltype(Vals)...>,
-        "This instanciation is neither a value tuple nor a value array.");
+template <typename T, auto... Vals>
+struct value_sequence : detail::value_sequence_impl<T, Vals...> {};
 
-    using value_sequence_elem<Is, Vals>::operator[]...;
+template <typename T, auto... Vals>
+struct at_impl<value_sequence<T, Vals...>> {
+  private:
+    // Named once per sequence, so that each lookup is O(1).
+    using values_t = detail::value_list<Vals...>;
+
+  public:
+    template <typename Iterable, typename Idx>
+    [[nodiscard]] static constexpr auto apply(Iterable &&, Idx) noexcept {
+        static_assert(Idx::value < sizeof...(Vals), "Index out of bounds");
+        return value_constant<values_t::template nth_value<Idx::value>>{};
+    }
 };
-} // namespace detail
 
 template <typename T, auto... Vals>
-struct value_sequence
-    : detail::value_sequence_impl<T, std::make_index_sequence<sizeof...(Vals)>,
-                                  Vals...> {};
+struct length_impl<value_sequence<T, Vals...>> {
+    template <typename Sized>
+    [[nodiscard]] static constexpr auto apply(Sized &&) noexcept
+        -> value_constant<sizeof...(Vals)> {
+        return {};
+    }
+};
 
 //template <typename T, auto... Vals>
 //struct tup_size<value_sequence<T, Vals...>>
@@ -111,6 +133,8 @@ struct tuple_size<::tr::value_sequence<T, Vals...>>
 
 template <std::size_t I, typename T, auto... Vals>
 struct tuple_element<I, ::tr::value_sequence<T, Vals...>> {
-    using type = decltype(::tr::value_sequence<T, Vals...>{}[tr::ic<I>]);
+    static_assert(I < sizeof...(Vals), "Index out of range");
+    using type = decltype(::tr::value_sequence<T, Vals...>{}
+                              [std::integral_constant<std::size_t, I>{}]);
 };
 } // namespace std
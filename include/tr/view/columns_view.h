@@ -0,0 +1,109 @@
+#pragma once
+
+#include <tr/view/fwd/columns_view.h>
+
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/soa_vector.h>
+#include <tr/unpack.h>
+#include <tr/view/tuple_view.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+/// @brief A range over the rows of a structure-of-arrays store (e.g. a
+/// `soa_vector`) that only reads the selected columns.
+///
+/// @details The store is a tuple of columns: the selected columns are picked
+/// by a `tuple_view` with the same index sequence. Iterating the view yields a
+/// `tuple` of references to the selected fields of each row:
+///
+/// @code
+/// tr::soa_vector<int, float, double, char> v;
+/// for (auto [i, c] : v | tr::columns<0, 3>) // tuple<int &, char &>
+///     c = static_cast<char>(i);
+/// @endcode
+///
+/// @tparam Soa The type of the store (a reference type, if the view doesn't
+/// own it).
+/// @tparam Is The indices of the selected columns.
+template <typename Soa, std::size_t... Is>
+struct columns_view<Soa, std::index_sequence<Is...>> {
+    static_assert(sizeof...(Is) != 0, "Select at least a column");
+
+  private:
+    using columns_t = tuple_view<Soa, std::index_sequence<Is...>>;
+
+    static constexpr std::size_t column_count{
+        decltype(length(std::declval<Soa>()))::value};
+    static_assert(((Is < column_count) && ...), "Column index out of range");
+
+    columns_t Columns_;
+
+    template <typename Columns>
+    [[nodiscard]] static auto begin_impl(Columns &columns) noexcept {
+        return unpack(columns, [](auto... cols) {
+            using iterator_t = detail::soa_iterator<
+                std::remove_pointer_t<decltype(cols.data())>...>;
+            return iterator_t{{cols.data()...}};
+        });
+    }
+
+  public:
+    template <typename Soa_>
+    constexpr explicit columns_view(Soa_ &&soa) noexcept(
+        std::is_nothrow_constructible_v<columns_t, Soa_ &&>)
+        : Columns_(std::forward<Soa_>(soa)) {}
+
+    /// @brief The number of rows.
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+        return at_c<0>(this->Columns_).size();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return this->size() == 0;
+    }
+
+    [[nodiscard]] auto begin() noexcept {
+        return columns_view::begin_impl(this->Columns_);
+    }
+
+    [[nodiscard]] auto begin() const noexcept {
+        return columns_view::begin_impl(this->Columns_);
+    }
+
+    [[nodiscard]] auto end() noexcept {
+        return this->begin() + static_cast<std::ptrdiff_t>(this->size());
+    }
+
+    [[nodiscard]] auto end() const noexcept {
+        return this->begin() + static_cast<std::ptrdiff_t>(this->size());
+    }
+
+    /// @brief Get the selected fields of the `row`-th row.
+    [[nodiscard]] auto operator[](std::size_t row) noexcept {
+        return this->begin()[static_cast<std::ptrdiff_t>(row)];
+    }
+
+    [[nodiscard]] auto operator[](std::size_t row) const noexcept {
+        return this->begin()[static_cast<std::ptrdiff_t>(row)];
+    }
+};
+
+template <std::size_t... Is>
+struct columns_t {};
+
+template <std::size_t... Is>
+static constexpr columns_t<Is...> columns{};
+
+template <typename Soa, std::size_t... Is>
+[[nodiscard]] constexpr auto operator|(Soa &&soa, columns_t<Is...>)
+    -> columns_view<Soa, std::index_sequence<Is...>> {
+    return columns_view<Soa, std::index_sequence<Is...>>{
+        std::forward<Soa>(soa)};
+}
+
+} // namespace tr
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <tr/view/fwd/concat_view.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/length.h>
+#include <tr/tuple.h>
+#include <tr/unpack.h>
+#include <tr/value_constant.h>
+#include <tr/view/view_interface.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief The position of an element of a `concat_view`: the index of the
+/// input tuple, and the index of the element in that tuple.
+struct concat_location {
+    std::size_t outer;
+    std::size_t inner;
+};
+
+/// @brief Map the indices of a `concat_view` over tuples of lengths `Ls...`
+/// to the positions of the elements in the input tuples.
+template <std::size_t... Ls>
+struct concat_indices {
+    static constexpr std::size_t size{(Ls + ... + 0)};
+
+    [[nodiscard]] static constexpr auto locate(std::size_t i) noexcept
+        -> concat_location {
+        constexpr std::size_t lengths[]{Ls..., 0};
+
+        std::size_t outer{};
+        while (i >= lengths[outer]) {
+            i -= lengths[outer];
+            ++outer;
+        }
+        return {outer, i};
+    }
+};
+
+template <typename... Tuples>
+using concat_indices_for_t = concat_indices<decltype(length(
+    std::declval<Tuples &>()))::value...>;
+
+} // namespace detail
+
+/// @brief A view over the elements of several tuple-like objects, one after
+/// the other.
+///
+/// @details Unlike `std::tuple_cat`, no element is copied (nor moved): the
+/// `I`-th element of the view is mapped to an element of one of the inputs at
+/// compile time, and accessed in place. Use `materialize` to get an owning
+/// `tuple` out of the view.
+///
+/// @tparam Tuples The types of the tuple-like objects (reference types, for
+/// the ones the view doesn't own).
+/// @ingroup views
+template <typename... Tuples>
+struct concat_view : view_interface<concat_view<Tuples...>> {
+  private:
+    template <typename... Tuples_>
+    static constexpr bool is_copy_v{
+        sizeof...(Tuples_) == 1 &&
+        (std::is_same_v<detail::remove_cvref_t<Tuples_>, concat_view> && ...)};
+
+  public:
+    friend at_impl<concat_view>;
+
+    template <typename... Tuples_,
+              std::enable_if_t<sizeof...(Tuples_) == sizeof...(Tuples) &&
+                                   !is_copy_v<Tuples_...>,
+                               bool> = true>
+    constexpr explicit concat_view(Tuples_ &&...tuples) noexcept(
+        (std::is_nothrow_constructible_v<Tuples, Tuples_ &&> && ...))
+        : tuples_{static_cast<Tuples_ &&>(tuples)...} {}
+
+    /// @brief Prepend `tuple` to the view, so that `t0 | concat(t1, t2)` is a
+    /// view over the elements of `t0`, `t1` and `t2`.
+    template <typename Tuple>
+    [[nodiscard]] friend constexpr auto operator|(Tuple &&tuple,
+                                                  concat_view &&view)
+        -> concat_view<Tuple, Tuples...> {
+        return unpack(std::move(view).tuples_, [&tuple](auto &&...tuples) {
+            return concat_view<Tuple, Tuples...>{
+                static_cast<Tuple &&>(tuple),
+                static_cast<decltype(tuples)>(tuples)...};
+        });
+    }
+
+  private:
+    tuple<Tuples...> tuples_;
+};
+
+template <typename... Tuples>
+struct at_impl<concat_view<Tuples...>> {
+  private:
+    using indices_t = detail::concat_indices_for_t<Tuples...>;
+
+  public:
+    template <typename ConcatView, typename Idx>
+    [[nodiscard]] static constexpr auto apply(ConcatView &&view, Idx)
+        -> decltype(auto) {
+        static_assert(Idx::value < indices_t::size, "Index out of bounds");
+        constexpr detail::concat_location loc{indices_t::locate(Idx::value)};
+        return at(at(static_cast<ConcatView &&>(view).tuples_,
+                     value_constant<loc.outer>{}),
+                  value_constant<loc.inner>{});
+    }
+};
+
+template <typename... Tuples>
+struct length_impl<concat_view<Tuples...>> {
+    template <typename ConcatView>
+    [[nodiscard]] static constexpr auto apply(ConcatView &&) noexcept
+        -> value_constant<detail::concat_indices_for_t<Tuples...>::size> {
+        return {};
+    }
+};
+
+/// @brief Make a view over the elements of `tuples...`, one after the other
+/// (see `concat_view`).
+template <typename... Tuples>
+[[nodiscard]] constexpr auto concat(Tuples &&...tuples) noexcept(
+    std::is_nothrow_constructible_v<concat_view<Tuples...>, Tuples &&...>)
+    -> concat_view<Tuples...> {
+    return concat_view<Tuples...>{static_cast<Tuples &&>(tuples)...};
+}
+
+} // namespace tr
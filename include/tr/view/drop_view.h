@@ -61,16 +61,28 @@ template <typename Tuple, std::size_t DropCount>
 struct length_impl<drop_view<Tuple, DropCount>>
     : length_impl<typename drop_view<Tuple, DropCount>::base_t> {};
 
+template <typename Tuple, std::size_t DropCount>
+struct contiguous_impl<drop_view<Tuple, DropCount>>
+    : contiguous_impl<typename drop_view<Tuple, DropCount>::base_t> {};
+
 template <std::size_t N>
 struct drop_t {};
 
 template <std::size_t N>
 static constexpr drop_t<N> drop_c{};
 
+/// @brief Drop the first `N` elements of `tuple`.
+/// @details If `tuple` is already a view over the elements of another tuple
+/// (e.g. a `reverse_view`), the result is a single `tuple_view` over the
+/// original tuple (see `detail::make_index_view`).
 template <typename Tuple, std::size_t N>
-[[nodiscard]] constexpr auto operator|(Tuple &&tuple, drop_t<N>)
-    -> drop_view<Tuple, N> {
-    return drop_view<Tuple, N>{std::forward<Tuple>(tuple)};
+[[nodiscard]] constexpr auto operator|(Tuple &&tuple, drop_t<N>) {
+    if constexpr (detail::is_tuple_view_v<detail::remove_cvref_t<Tuple>>) {
+        return detail::make_index_view<detail::drop_indices_for_t<Tuple, N>>(
+            std::forward<Tuple>(tuple));
+    } else {
+        return drop_view<Tuple, N>{std::forward<Tuple>(tuple)};
+    }
 }
 
 } // namespace tr
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <tr/view/fwd/filter_types_view.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/indices_for.h>
+#include <tr/length.h>
+#include <tr/view/tuple_view.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief A set of (at most `N`) indices, computed at compile time.
+template <std::size_t N>
+struct index_buffer {
+    std::size_t values[N + 1]{};
+    std::size_t size{};
+
+    constexpr void push_back(std::size_t i) noexcept {
+        this->values[this->size++] = i;
+    }
+};
+
+/// @brief Get the `index_sequence` of the indices in `Selector::value` (an
+/// `index_buffer`).
+template <typename Selector,
+          typename = std::make_index_sequence<Selector::value.size>>
+struct selected_indices;
+
+template <typename Selector, std::size_t... Js>
+struct selected_indices<Selector, std::index_sequence<Js...>> {
+    using type = std::index_sequence<Selector::value.values[Js]...>;
+};
+
+template <typename Selector>
+using selected_indices_t = typename selected_indices<Selector>::type;
+
+/// @brief The type of the `I`-th element of a `Tuple`, without cv-ref
+/// qualifiers.
+template <typename Tuple, std::size_t I>
+using element_type_t =
+    remove_cvref_t<decltype(at_c<I>(std::declval<Tuple &>()))>;
+
+template <typename Tuple, template <typename> typename Pred,
+          typename IdxPack = decltype(indices_for(std::declval<Tuple &>()))>
+struct filter_selector;
+
+template <typename Tuple, template <typename> typename Pred, std::size_t... Is>
+struct filter_selector<Tuple, Pred, std::index_sequence<Is...>> {
+    static constexpr index_buffer<sizeof...(Is)> value{[] {
+        constexpr bool keep[]{
+            static_cast<bool>(Pred<element_type_t<Tuple, Is>>::value)...,
+            false};
+
+        index_buffer<sizeof...(Is)> res{};
+        for (std::size_t i{}; i != sizeof...(Is); ++i) {
+            if (keep[i]) {
+                res.push_back(i);
+            }
+        }
+        return res;
+    }()};
+};
+
+template <typename Tuple, template <typename> typename Pred>
+using filter_indices_for_t = selected_indices_t<filter_selector<Tuple, Pred>>;
+
+} // namespace detail
+
+/// @brief A view over the elements of a tuple-like object whose type
+/// satisfies `Pred` (e.g. `std::is_arithmetic`).
+///
+/// @details The indices of the selected elements are computed at compile time,
+/// so the elements that don't satisfy `Pred` are never visited:
+///
+/// @code
+/// tr::tuple<int, std::string, double> record{...};
+/// tr::for_each(record | tr::filter_types<std::is_arithmetic>, f);
+/// //           ^ calls `f` on the `int` and the `double`.
+/// @endcode
+///
+/// @tparam Tuple The type of the tuple-like object (a reference type, if the
+/// view doesn't own it).
+/// @tparam Pred A unary type trait, checked on the element types without
+/// cv-ref qualifiers.
+/// @ingroup views
+template <typename Tuple, template <typename> typename Pred>
+struct filter_types_view
+    : tuple_view<Tuple, detail::filter_indices_for_t<Tuple, Pred>> {
+
+    using base_t = tuple_view<Tuple, detail::filter_indices_for_t<Tuple, Pred>>;
+
+    template <typename Tuple_>
+    constexpr explicit filter_types_view(Tuple_ &&tuple) noexcept(
+        std::is_nothrow_constructible_v<base_t, Tuple_ &&>)
+        : base_t(std::forward<Tuple_>(tuple)) {}
+};
+
+template <typename Tuple, template <typename> typename Pred>
+struct at_impl<filter_types_view<Tuple, Pred>>
+    : at_impl<typename filter_types_view<Tuple, Pred>::base_t> {};
+
+template <typename Tuple, template <typename> typename Pred>
+struct length_impl<filter_types_view<Tuple, Pred>>
+    : length_impl<typename filter_types_view<Tuple, Pred>::base_t> {};
+
+template <typename Tuple, template <typename> typename Pred>
+struct contiguous_impl<filter_types_view<Tuple, Pred>>
+    : contiguous_impl<typename filter_types_view<Tuple, Pred>::base_t> {};
+
+template <template <typename> typename Pred>
+struct filter_types_t {};
+
+template <template <typename> typename Pred>
+static constexpr filter_types_t<Pred> filter_types{};
+
+template <typename Tuple, template <typename> typename Pred>
+[[nodiscard]] constexpr auto operator|(Tuple &&tuple, filter_types_t<Pred>) {
+    if constexpr (detail::is_tuple_view_v<detail::remove_cvref_t<Tuple>>) {
+        return detail::make_index_view<
+            detail::filter_indices_for_t<Tuple, Pred>>(
+            std::forward<Tuple>(tuple));
+    } else {
+        return filter_types_view<Tuple, Pred>{std::forward<Tuple>(tuple)};
+    }
+}
+
+} // namespace tr
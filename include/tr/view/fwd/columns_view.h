@@ -0,0 +1,6 @@
+#pragma once
+
+namespace tr {
+template <typename Soa, typename IdxPack>
+struct columns_view;
+}
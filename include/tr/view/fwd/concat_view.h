@@ -0,0 +1,6 @@
+#pragma once
+
+namespace tr {
+template <typename... Tuples>
+struct concat_view;
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace tr {
+template <typename Tuple, template <typename> typename Pred>
+struct filter_types_view;
+}
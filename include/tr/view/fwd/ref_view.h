@@ -0,0 +1,6 @@
+#pragma once
+
+namespace tr {
+template <typename Tuple>
+struct ref_view;
+}
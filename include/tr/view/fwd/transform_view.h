@@ -0,0 +1,6 @@
+#pragma once
+
+namespace tr {
+template <typename Tuple, typename Func>
+struct transform_view;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <tr/detail/type_traits.h>
+#include <tr/indices_for.h>
+#include <tr/tuple.h>
+#include <tr/view/filter_types_view.h>
+#include <tr/view/tuple_view.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+template <typename T>
+static constexpr char type_id_tag{};
+
+/// @brief Group the elements of a `Tuple` by type (without cv-ref
+/// qualifiers), in order of first appearance.
+template <typename Tuple,
+          typename IdxPack = decltype(indices_for(std::declval<Tuple &>()))>
+struct type_groups;
+
+template <typename Tuple, std::size_t... Is>
+struct type_groups<Tuple, std::index_sequence<Is...>> {
+  private:
+    static constexpr std::size_t n{sizeof...(Is)};
+
+    // Comparing addresses is O(N^2) in constant evaluation, but it only
+    // instantiates O(N) templates.
+    static constexpr void const *ids[]{
+        &type_id_tag<element_type_t<Tuple, Is>>..., nullptr};
+
+  public:
+    /// @brief The index of the first element of each group.
+    static constexpr index_buffer<n> leaders{[] {
+        index_buffer<n> res{};
+        for (std::size_t i{}; i != n; ++i) {
+            bool isFirst{true};
+            for (std::size_t j{}; j != i; ++j) {
+                isFirst = isFirst && ids[j] != ids[i];
+            }
+            if (isFirst) {
+                res.push_back(i);
+            }
+        }
+        return res;
+    }()};
+
+    /// @brief The indices of the elements in the `G`-th group.
+    template <std::size_t G>
+    struct group {
+        static constexpr index_buffer<n> value{[] {
+            index_buffer<n> res{};
+            for (std::size_t i{}; i != n; ++i) {
+                if (ids[i] == ids[leaders.values[G]]) {
+                    res.push_back(i);
+                }
+            }
+            return res;
+        }()};
+    };
+};
+
+template <typename Tuple, std::size_t G>
+using type_group_indices_t =
+    selected_indices_t<typename type_groups<Tuple>::template group<G>>;
+
+template <typename Tuple, std::size_t... Gs>
+constexpr auto group_by_type_impl(Tuple &tuple, std::index_sequence<Gs...>)
+    -> tr::tuple<decltype(make_index_view<type_group_indices_t<Tuple, Gs>>(
+        tuple))...> {
+    return {make_index_view<type_group_indices_t<Tuple, Gs>>(tuple)...};
+}
+
+} // namespace detail
+
+struct group_by_type_t {
+    /// @brief Split the elements of a tuple-like object into one view per
+    /// distinct element type (without cv-ref qualifiers), in order of first
+    /// appearance.
+    /// @details Each group is a `tuple_view` over `tuple`, so that
+    /// homogeneous batches can be processed on their own (e.g. by the SIMD
+    /// kernels of `fold_left`).
+    /// @param tuple The tuple-like object (an l-value, as the views refer to
+    /// it).
+    /// @return A `tuple` of views.
+    template <typename Tuple>
+    [[nodiscard]] constexpr auto operator()(Tuple &tuple) const {
+        using groups_t = detail::type_groups<Tuple>;
+        return detail::group_by_type_impl(
+            tuple, std::make_index_sequence<groups_t::leaders.size>{});
+    }
+
+    template <typename Tuple>
+    auto operator()(Tuple const &&) const = delete;
+};
+
+static constexpr group_by_type_t group_by_type{};
+
+template <typename Tuple>
+[[nodiscard]] constexpr auto operator|(Tuple &tuple, group_by_type_t g) {
+    return g(tuple);
+}
+
+template <typename Tuple>
+auto operator|(Tuple const &&, group_by_type_t) = delete;
+
+} // namespace tr
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <tr/view/fwd/ref_view.h>
+
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/tuple_iterator.h>
+#include <tr/view/view_interface.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+/// @brief A view that borrows a tuple-like object: it only holds its address.
+///
+/// @details Views store the tuple they're applied to as it's passed: by
+/// reference, if it's an l-value (the view is pointer-sized); by value, if
+/// it's an r-value (the view owns it, and moves it into the next view of a
+/// chain like `make_row() | tr::reverse | tr::drop_c<1>`). Wrapping the tuple
+/// into a `ref_view` borrows it in any case, so that a chain of views only
+/// copies a pointer around, even when the views are returned by value:
+///
+/// @code
+/// auto tail(row_t &row) { return tr::ref(row) | tr::drop_c<1>; }
+/// @endcode
+///
+/// The tuple must outlive the views. Its elements are always accessed as
+/// l-values.
+/// @tparam Tuple The type of the tuple-like object (possibly const).
+/// @ingroup views
+template <typename Tuple>
+struct ref_view : view_interface<ref_view<Tuple>> {
+  public:
+    constexpr explicit ref_view(Tuple &tuple) noexcept : tuple_{&tuple} {}
+
+    /// @brief Get the borrowed tuple-like object.
+    [[nodiscard]] constexpr auto base() const noexcept -> Tuple & {
+        return *tuple_;
+    }
+
+  private:
+    Tuple *tuple_;
+};
+
+template <typename Tuple>
+struct at_impl<ref_view<Tuple>> {
+    template <typename RefView, typename Idx>
+    [[nodiscard]] static constexpr auto apply(RefView &&view, Idx idx)
+        -> decltype(auto) {
+        return at(view.base(), idx);
+    }
+};
+
+template <typename Tuple>
+struct length_impl<ref_view<Tuple>> {
+    template <typename RefView>
+    [[nodiscard]] static constexpr auto apply(RefView &&) noexcept
+        -> decltype(length(std::declval<Tuple &>())) {
+        return {};
+    }
+};
+
+template <typename Tuple>
+struct contiguous_impl<ref_view<Tuple>,
+                       std::enable_if_t<is_implemented_v<
+                           contiguous_impl<std::remove_cv_t<Tuple>>>>> {
+
+    template <typename RefView>
+    [[nodiscard]] static constexpr auto apply(RefView &view) noexcept {
+        return contiguous_impl<std::remove_cv_t<Tuple>>::apply(view.base());
+    }
+};
+
+/// @brief Borrow `tuple` (see `ref_view`).
+template <typename Tuple>
+[[nodiscard]] constexpr auto ref(Tuple &tuple) noexcept -> ref_view<Tuple> {
+    return ref_view<Tuple>{tuple};
+}
+
+/// @brief Temporaries can't be borrowed, as they would dangle.
+template <typename Tuple>
+void ref(Tuple const &&) = delete;
+
+} // namespace tr
@@ -39,14 +39,26 @@ template <typename Tuple>
 struct length_impl<reverse_view<Tuple>>
     : length_impl<typename reverse_view<Tuple>::base_t> {};
 
+template <typename Tuple>
+struct contiguous_impl<reverse_view<Tuple>>
+    : contiguous_impl<typename reverse_view<Tuple>::base_t> {};
+
 struct reverse_t {};
 
 static constexpr reverse_t reverse{};
 
+/// @brief Reverse the elements of `tuple`.
+/// @details If `tuple` is already a view over the elements of another tuple
+/// (e.g. a `drop_view`), the result is a single `tuple_view` over the
+/// original tuple (see `detail::make_index_view`).
 template <typename Tuple>
-[[nodiscard]] constexpr auto operator|(Tuple &&tuple, reverse_t)
-    -> reverse_view<Tuple> {
-    return reverse_view<Tuple>{std::forward<Tuple>(tuple)};
+[[nodiscard]] constexpr auto operator|(Tuple &&tuple, reverse_t) {
+    if constexpr (detail::is_tuple_view_v<detail::remove_cvref_t<Tuple>>) {
+        return detail::make_index_view<detail::reverse_indices_for_t<Tuple>>(
+            std::forward<Tuple>(tuple));
+    } else {
+        return reverse_view<Tuple>{std::forward<Tuple>(tuple)};
+    }
 }
 
 } // namespace tr
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <tr/view/fwd/transform_view.h>
+
+#include <tr/at.h>
+#include <tr/detail/ebo.h>
+#include <tr/invoke.h>
+#include <tr/length.h>
+#include <tr/view/view_interface.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+/// @brief A view that applies a function to the elements of a tuple-like
+/// object, when they're accessed.
+///
+/// @details No element is computed nor stored upfront: `at(view, i)` returns
+/// `invoke(func, at(tuple, i))`, so views stacked on top of this one (e.g.
+/// `drop_view`) only call `func` on the elements they access:
+///
+/// @code
+/// auto fields = row | tr::transform(parse) | tr::drop_c<1>;
+/// //   ^ calls `parse` on `at(row, 1_ic)`, `at(row, 2_ic)`... on demand
+/// @endcode
+///
+/// @tparam Tuple The type of the tuple-like object (a reference type, if the
+/// view doesn't own it).
+/// @tparam Func The type of the function.
+/// @ingroup views
+template <typename Tuple, typename Func>
+struct transform_view
+    : view_interface<transform_view<Tuple, Func>>,
+      private detail::ebo<Func, transform_view<Tuple, Func>> {
+  private:
+    using func_base_t = detail::ebo<Func, transform_view>;
+
+  public:
+    friend at_impl<transform_view>;
+    friend length_impl<transform_view>;
+
+    template <typename Tuple_, typename Func_>
+    constexpr transform_view(Tuple_ &&tuple, Func_ &&func) noexcept(
+        std::is_nothrow_constructible_v<Tuple, Tuple_ &&> &&
+        std::is_nothrow_constructible_v<Func, Func_ &&>)
+        : func_base_t{static_cast<Func_ &&>(func)},
+          tuple_(static_cast<Tuple_ &&>(tuple)) {}
+
+  private:
+    Tuple tuple_;
+
+    [[nodiscard]] constexpr auto func() &noexcept -> Func & {
+        return this->value();
+    }
+
+    [[nodiscard]] constexpr auto func() const &noexcept -> Func const & {
+        return this->value();
+    }
+};
+
+template <typename Tuple, typename Func>
+struct at_impl<transform_view<Tuple, Func>> {
+    template <typename TransformView, typename Idx>
+    [[nodiscard]] static constexpr auto apply(TransformView &&view, Idx idx)
+        -> decltype(auto) {
+        // `func` is called as an l-value even if the view is an r-value, as
+        // it may be called again for other elements.
+        return tr::invoke(view.func(),
+                          at(static_cast<TransformView &&>(view).tuple_, idx));
+    }
+};
+
+template <typename Tuple, typename Func>
+struct length_impl<transform_view<Tuple, Func>> {
+    template <typename TransformView>
+    [[nodiscard]] static constexpr auto apply(TransformView &&view) noexcept {
+        return length(view.tuple_);
+    }
+};
+
+template <typename Func>
+struct transform_t {
+    Func Func_;
+};
+
+/// @brief Make a view that applies `func` to the elements of a tuple-like
+/// object (see `transform_view`).
+template <typename Func>
+[[nodiscard]] constexpr auto transform(Func func) noexcept(
+    std::is_nothrow_move_constructible_v<Func>) -> transform_t<Func> {
+    return {static_cast<Func &&>(func)};
+}
+
+template <typename Tuple, typename Func>
+[[nodiscard]] constexpr auto operator|(Tuple &&tuple, transform_t<Func> adaptor)
+    -> transform_view<Tuple, Func> {
+    return transform_view<Tuple, Func>{std::forward<Tuple>(tuple),
+                                       std::move(adaptor.Func_)};
+}
+
+} // namespace tr
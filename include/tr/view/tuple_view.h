@@ -2,24 +2,41 @@
 
 #include <tr/fwd/at.h>
 #include <tr/fwd/length.h>
+#include <tr/fwd/tuple_iterator.h>
 
+#include <tr/detail/nth_type.h>
+#include <tr/detail/type_traits.h>
+#include <tr/is_valid.h>
 #include <tr/tuple_protocol.h>
 #include <tr/tuple_protocol/std_integer_sequence.h>
 #include <tr/value_constant.h>
 #include <tr/view/view_interface.h>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 namespace tr {
 template <typename Tuple, typename IdxPack>
 struct tuple_view;
 
+namespace detail {
+struct tuple_view_access;
+}
+
+/// @brief A view over the elements `Is...` of a tuple-like object, in this
+/// order.
+/// @details The view refers to the tuple if `Tuple` is an l-value reference
+/// type (the view is then pointer-sized), and owns it otherwise: views built
+/// from r-values hold the only copy of their tuple (see also `ref_view`).
+/// @tparam Tuple The type of the tuple-like object.
+/// @ingroup views
 template <typename Tuple, std::size_t... Is>
 struct tuple_view<Tuple, std::index_sequence<Is...>>
     : view_interface<tuple_view<Tuple, std::index_sequence<Is...>>> {
   public:
     friend at_impl<tuple_view>;
+    friend detail::tuple_view_access;
     using index_sequence_t = std::index_sequence<Is...>;
 
     template <typename Tuple_>
@@ -33,12 +50,16 @@ struct tuple_view<Tuple, std::index_sequence<Is...>>
 
 template <typename Tuple, std::size_t... Is>
 struct at_impl<tuple_view<Tuple, std::index_sequence<Is...>>> {
+  private:
+    using indices_t = detail::value_array<std::size_t, Is...>;
 
+  public:
     template <typename TupleView, typename Idx>
-    [[nodiscard]] static constexpr auto apply(TupleView &&tupleView, Idx idx)
+    [[nodiscard]] static constexpr auto apply(TupleView &&tupleView, Idx)
         -> decltype(auto) {
-        using index_sequence_t = std::index_sequence<Is...>;
-        auto realIdx = at(index_sequence_t{}, idx);
+        constexpr std::size_t i{Idx::value};
+        static_assert(i < sizeof...(Is), "Index out of bounds");
+        value_constant<indices_t::values[i]> realIdx{};
         return at(std::forward<TupleView>(tupleView).tuple_, realIdx);
     }
 };
@@ -53,6 +74,99 @@ struct length_impl<tuple_view<Tuple, std::index_sequence<Is...>>> {
     }
 };
 
+namespace detail {
+
+struct tuple_view_access {
+    template <typename TupleView>
+    [[nodiscard]] static constexpr auto base(TupleView &&view) noexcept
+        -> decltype(auto) {
+        return (static_cast<TupleView &&>(view).tuple_);
+    }
+};
+
+template <typename Tuple, std::size_t... Is>
+auto as_tuple_view(tuple_view<Tuple, std::index_sequence<Is...>> const &)
+    -> tuple_view<Tuple, std::index_sequence<Is...>> /* unimplemented */;
+
+/// @brief Get the `tuple_view` a view derives from (e.g. a `drop_view`).
+template <typename View>
+using as_tuple_view_t =
+    decltype(detail::as_tuple_view(std::declval<View const &>()));
+
+template <typename View>
+static constexpr bool is_tuple_view_v{
+    is_valid_type_expr_v<as_tuple_view_t, View>};
+
+/// @brief Check whether `I0, Is...` are consecutive indices.
+template <std::size_t I0, std::size_t... Is>
+[[nodiscard]] constexpr auto are_consecutive() noexcept -> bool {
+    std::size_t const indices[]{I0, Is...};
+    for (std::size_t i{}; i != sizeof...(Is) + 1; ++i) {
+        if (indices[i] != I0 + i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Outer, typename Inner>
+struct compose_indices;
+
+/// @brief Select the elements `Js...` out of the elements `Is...` of a tuple.
+template <std::size_t... Is, std::size_t... Js>
+struct compose_indices<std::index_sequence<Is...>,
+                       std::index_sequence<Js...>> {
+    using type =
+        std::index_sequence<value_array<std::size_t, Is...>::values[Js]...>;
+};
+
+/// @brief Make a `tuple_view` over the elements `IdxPack` of `tuple`.
+///
+/// @details If `tuple` is a `tuple_view` itself (e.g. a `drop_view`), the two
+/// index sequences are composed, and the result is a view over the original
+/// tuple: chains of views like `t | reverse | drop_c<1> | reverse` collapse
+/// into a single `tuple_view`, so that an access goes through a single
+/// indirection. The original tuple is referred to if the view is an l-value,
+/// and moved into the result if the view is an r-value that owns it.
+template <typename IdxPack, typename Tuple>
+[[nodiscard]] constexpr auto make_index_view(Tuple &&tuple) {
+    using tuple_t = remove_cvref_t<Tuple>;
+
+    if constexpr (is_tuple_view_v<tuple_t>) {
+        using outer_t = typename as_tuple_view_t<tuple_t>::index_sequence_t;
+        using indices_t = typename compose_indices<outer_t, IdxPack>::type;
+
+        using base_ref_t =
+            decltype(tuple_view_access::base(std::declval<Tuple>()));
+        using base_t =
+            std::conditional_t<std::is_lvalue_reference_v<base_ref_t>,
+                               base_ref_t, remove_cvref_t<base_ref_t>>;
+
+        return tuple_view<base_t, indices_t>{
+            tuple_view_access::base(static_cast<Tuple &&>(tuple))};
+    } else {
+        return tuple_view<Tuple, IdxPack>{static_cast<Tuple &&>(tuple)};
+    }
+}
+
+} // namespace detail
+
+/// @brief A view over consecutive elements of a contiguous tuple-like object
+/// (e.g. `arr | drop_c<1>`, with `arr` a built-in array) is contiguous.
+template <typename Tuple, std::size_t I0, std::size_t... Is>
+struct contiguous_impl<
+    tuple_view<Tuple, std::index_sequence<I0, Is...>>,
+    std::enable_if_t<
+        detail::are_consecutive<I0, Is...>() &&
+        is_implemented_v<contiguous_impl<detail::remove_cvref_t<Tuple>>>>> {
+
+    template <typename TupleView>
+    [[nodiscard]] static constexpr auto apply(TupleView &view) noexcept {
+        using base_impl_t = contiguous_impl<detail::remove_cvref_t<Tuple>>;
+        return base_impl_t::apply(detail::tuple_view_access::base(view)) + I0;
+    }
+};
+
 // template <typename Tuple, std::size_t... Is>
 // constexpr std::index_sequence<Is...>
 // index_seq(tuple_view<Tuple, std::index_sequence<Is...>> const &) noexcept {
@@ -5,6 +5,7 @@
 #include <tr/at.h>
 #include <tr/detail/type_traits.h>
 #include <tr/length.h>
+#include <tr/tuple_iterator.h>
 #include <tr/type_constant.h>
 #include <tr/unimplemented.h>
 
@@ -43,6 +44,34 @@ struct view_interface {
         return length(static_cast<Derived const &>(*this));
     }
 
+    /// @brief Get an iterator to the first element, if they all have the
+    /// same type (see `tr::begin`).
+    template <typename D = Derived,
+              typename = std::enable_if_t<detail::is_tuple_range_v<D>>>
+    [[nodiscard]] constexpr auto begin() noexcept {
+        return detail::tuple_begin(static_cast<D &>(*this));
+    }
+
+    template <typename D = Derived,
+              typename = std::enable_if_t<detail::is_tuple_range_v<D const>>>
+    [[nodiscard]] constexpr auto begin() const noexcept {
+        return detail::tuple_begin(static_cast<D const &>(*this));
+    }
+
+    /// @brief Get an iterator past the last element, if they all have the
+    /// same type (see `tr::end`).
+    template <typename D = Derived,
+              typename = std::enable_if_t<detail::is_tuple_range_v<D>>>
+    [[nodiscard]] constexpr auto end() noexcept {
+        return detail::tuple_end(static_cast<D &>(*this));
+    }
+
+    template <typename D = Derived,
+              typename = std::enable_if_t<detail::is_tuple_range_v<D const>>>
+    [[nodiscard]] constexpr auto end() const noexcept {
+        return detail::tuple_end(static_cast<D const &>(*this));
+    }
+
     template <typename T, T I>
     [[nodiscard]] constexpr decltype(auto)
     operator[](std::integral_constant<T, I> idx) & {
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <tr/fwd/visit_at.h>
+
+#include <tr/at.h>
+#include <tr/detail/type_traits.h>
+#include <tr/invoke.h>
+#include <tr/length.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+/// @brief The largest tuple for which `visit_at` dispatches through a
+/// `switch` rather than through a table of function pointers.
+static constexpr std::size_t visit_at_switch_max{8};
+
+template <typename Tuple, typename Func, std::size_t I>
+using visit_result_t = decltype(tr::invoke(
+    std::declval<Func>(), at_c<I>(std::declval<Tuple>())));
+
+template <typename R, std::size_t I, typename Tuple, typename Func>
+constexpr auto visit_nth(Tuple &&t, Func &&f) -> R {
+    return tr::invoke(static_cast<Func &&>(f),
+                      at_c<I>(static_cast<Tuple &&>(t)));
+}
+
+template <typename R, typename Tuple, typename Func, typename IdxPack>
+struct visit_table;
+
+template <typename R, typename Tuple, typename Func, std::size_t... Is>
+struct visit_table<R, Tuple, Func, std::index_sequence<Is...>> {
+    using visitor_t = R (*)(Tuple &&, Func &&);
+
+    static constexpr visitor_t visitors[]{&visit_nth<R, Is, Tuple, Func>...};
+};
+
+/// @brief Dispatch to the `i`-th `visit_nth` of a tuple with `N` elements
+/// through a `switch`, which compilers turn into a jump table (or into a
+/// couple of compares, for very small tuples).
+/// @pre `i < N`.
+template <typename R, std::size_t N, typename Tuple, typename Func>
+constexpr auto visit_switch(Tuple &&t, std::size_t i, Func &&f) -> R {
+    static_assert(N <= visit_at_switch_max);
+
+#define TR_VISIT_AT_CASE(K)                                                    \
+    case K:                                                                    \
+        if constexpr (K < N) {                                                 \
+            return visit_nth<R, K>(static_cast<Tuple &&>(t),                   \
+                                   static_cast<Func &&>(f));                   \
+        }                                                                      \
+        [[fallthrough]]
+
+    switch (i) {
+        TR_VISIT_AT_CASE(0);
+        TR_VISIT_AT_CASE(1);
+        TR_VISIT_AT_CASE(2);
+        TR_VISIT_AT_CASE(3);
+        TR_VISIT_AT_CASE(4);
+        TR_VISIT_AT_CASE(5);
+        TR_VISIT_AT_CASE(6);
+        TR_VISIT_AT_CASE(7);
+    default:
+        break;
+    }
+
+#undef TR_VISIT_AT_CASE
+
+    // Unreachable: the caller checked `i`.
+    return visit_nth<R, 0>(static_cast<Tuple &&>(t), static_cast<Func &&>(f));
+}
+
+} // namespace detail
+
+template <typename Tuple, typename Func>
+constexpr auto visit_at_t::operator()(Tuple &&t, std::size_t i,
+                                      Func &&f) const -> decltype(auto) {
+    using tuple_t = detail::remove_cvref_t<Tuple>;
+    return visit_at_impl<tuple_t>::apply(static_cast<Tuple &&>(t), i,
+                                         static_cast<Func &&>(f));
+}
+
+template <typename T>
+struct visit_at_impl<T,
+                     std::enable_if_t<is_implemented_v<at_impl<T>> &&
+                                      is_implemented_v<length_impl<T>>>> {
+
+    template <typename Tuple, typename Func, std::size_t... Is>
+    static constexpr auto apply_impl(Tuple &&t, std::size_t i, Func &&f,
+                                     std::index_sequence<Is...>)
+        -> decltype(auto) {
+        constexpr std::size_t n{sizeof...(Is)};
+        static_assert(n != 0, "Can't visit an element of an empty tuple");
+
+        using result_t = detail::visit_result_t<Tuple, Func, 0>;
+        static_assert(
+            (std::is_same_v<result_t,
+                            detail::visit_result_t<Tuple, Func, Is>> &&
+             ...),
+            "visit_at requires the same result type for all elements");
+
+        if (i >= n) {
+            throw std::out_of_range{"tr::visit_at: index out of range"};
+        }
+
+        if constexpr (n <= detail::visit_at_switch_max) {
+            return detail::visit_switch<result_t, n>(
+                static_cast<Tuple &&>(t), i, static_cast<Func &&>(f));
+        } else {
+            using table_t =
+                detail::visit_table<result_t, Tuple, Func,
+                                    std::index_sequence<Is...>>;
+            return table_t::visitors[i](static_cast<Tuple &&>(t),
+                                        static_cast<Func &&>(f));
+        }
+    }
+
+    /// @brief Invoke `f` with the `i`-th element of `t`.
+    /// @details The element is selected in O(1): through a `switch` for small
+    /// tuples, and through a table of function pointers otherwise. `f` must
+    /// return the same type for every element.
+    /// @throw std::out_of_range if `i` is not less than the length of `t`.
+    template <typename Tuple, typename Func>
+    static constexpr auto apply(Tuple &&t, std::size_t i, Func &&f)
+        -> decltype(auto) {
+        constexpr std::size_t n{decltype(tr::length(t))::value};
+        return visit_at_impl::apply_impl(static_cast<Tuple &&>(t), i,
+                                         static_cast<Func &&>(f),
+                                         std::make_index_sequence<n>{});
+    }
+};
+
+} // namespace tr
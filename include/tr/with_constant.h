@@ -0,0 +1,144 @@
+#pragma once
+
+#include <tr/invoke.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tr {
+
+namespace detail {
+
+[[nodiscard]] constexpr auto ipow(std::size_t base, std::size_t exp) noexcept
+    -> std::size_t {
+    std::size_t res{1};
+    while (exp-- != 0) {
+        res *= base;
+    }
+    return res;
+}
+
+/// @brief The points of the grid `[Lo, Lo + N)^K`, laid out in row-major
+/// order: point `F` is `(Lo + F / N^(K-1) % N, ..., Lo + F % N)`.
+template <typename T, T Lo, std::size_t N, typename DimPack>
+struct constant_grid;
+
+template <typename T, T Lo, std::size_t N, std::size_t... Ks>
+struct constant_grid<T, Lo, N, std::index_sequence<Ks...>> {
+    static constexpr std::size_t rank{sizeof...(Ks)};
+    static constexpr std::size_t size{ipow(N, rank)};
+
+    template <std::size_t F, std::size_t K>
+    static constexpr T coord{
+        static_cast<T>(Lo + static_cast<T>(F / ipow(N, rank - 1 - K) % N))};
+
+    template <typename Func, std::size_t F>
+    using result_t =
+        decltype(tr::invoke(std::declval<Func>(), value_c<coord<F, Ks>>...));
+
+    template <typename R, std::size_t F, typename Func>
+    static constexpr auto invoke_at(Func &&f) -> R {
+        static_assert(std::is_same_v<R, result_t<Func, F>>,
+                      "with_constant requires the same result type for all "
+                      "values");
+        return tr::invoke(static_cast<Func &&>(f), value_c<coord<F, Ks>>...);
+    }
+
+    template <typename R, typename Func, typename FlatPack>
+    struct table;
+
+    template <typename R, typename Func, std::size_t... Fs>
+    struct table<R, Func, std::index_sequence<Fs...>> {
+        using invoker_t = R (*)(Func &&);
+
+        static constexpr invoker_t invokers[]{&invoke_at<R, Fs, Func>...};
+    };
+
+    /// @brief Invoke `f` with the constants equal to `vals`.
+    /// @pre Each of `vals` is in `[Lo, Lo + N)`.
+    template <typename Func>
+    static constexpr auto apply(T const (&vals)[rank], Func &&f)
+        -> decltype(auto) {
+        using table_t =
+            table<result_t<Func, 0>, Func, std::make_index_sequence<size>>;
+
+        std::size_t flat{};
+        ((flat = flat * N + static_cast<std::size_t>(vals[Ks] - Lo)), ...);
+        return table_t::invokers[flat](static_cast<Func &&>(f));
+    }
+};
+
+template <auto Lo, auto Hi>
+static constexpr std::size_t constant_range_size{[] {
+    static_assert(std::is_integral_v<decltype(Lo)> &&
+                      std::is_same_v<decltype(Lo), decltype(Hi)>,
+                  "The bounds must be integers of the same type");
+    static_assert(Lo < Hi, "The range can't be empty");
+    return static_cast<std::size_t>(Hi - Lo);
+}()};
+
+template <auto Lo, auto Hi, std::size_t K, typename Func>
+constexpr auto with_constants(decltype(Lo) const (&vals)[K], Func &&f)
+    -> decltype(auto) {
+    using grid_t = constant_grid<decltype(Lo), Lo, constant_range_size<Lo, Hi>,
+                                 std::make_index_sequence<K>>;
+
+    for (auto val : vals) {
+        if (val < Lo || !(val < Hi)) {
+            throw std::out_of_range{"tr::with_constant: value out of range"};
+        }
+    }
+
+    return grid_t::apply(vals, static_cast<Func &&>(f));
+}
+
+} // namespace detail
+
+/// @brief Invoke `f` with `value_c<V>`, where `V == val`.
+///
+/// @details Lift a runtime integer in `[Lo, Hi)` into a `value_constant`, so
+/// that a kernel specialized on that value (e.g. a fully unrolled loop) can be
+/// selected at runtime. The specialization is picked in O(1) through a table
+/// with one entry per value in the range, so keep the range small.
+///
+/// @code
+/// auto const sum = tr::with_constant<1, 9>(width, [&](auto w) {
+///     return sum_rows<w>(data);
+/// });
+/// @endcode
+///
+/// `f` must return the same type for every value.
+///
+/// @tparam Lo The first value in the range.
+/// @tparam Hi The value past the last one in the range.
+/// @param val The value to lift.
+/// @param f The function to invoke.
+/// @throw std::out_of_range if `val` is not in `[Lo, Hi)`.
+template <auto Lo, auto Hi, typename Func>
+constexpr auto with_constant(decltype(Lo) val, Func &&f) -> decltype(auto) {
+    decltype(Lo) const vals[]{val};
+    return detail::with_constants<Lo, Hi>(vals, static_cast<Func &&>(f));
+}
+
+/// @brief Invoke `f` with `value_c<Vs>...`, where `Vs == vals`.
+///
+/// @details Like the single-value overload, but lift several values in
+/// `[Lo, Hi)` at once. The table has `(Hi - Lo)^K` entries:
+///
+/// @code
+/// tr::with_constant<1, 5>({rows, cols}, [&](auto r, auto c) {
+///     matrix_kernel<r, c>(data);
+/// });
+/// @endcode
+///
+/// @throw std::out_of_range if any of `vals` is not in `[Lo, Hi)`.
+template <auto Lo, auto Hi, std::size_t K, typename Func>
+constexpr auto with_constant(decltype(Lo) const (&vals)[K], Func &&f)
+    -> decltype(auto) {
+    return detail::with_constants<Lo, Hi>(vals, static_cast<Func &&>(f));
+}
+
+} // namespace tr
@@ -0,0 +1,89 @@
+#include <tr/tuple_protocol/aggregate.h>
+
+#include <tr/algorithm/fold_left.h>
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/type_constant.h>
+#include <tr/unpack.h>
+#include <tr/view/reverse_view.h>
+
+#include <string>
+#include <utility>
+
+using tr::aggregate_size_v;
+using tr::at_c;
+using tr::type_c;
+
+namespace {
+
+struct point {
+    int x;
+    int y;
+};
+
+struct record {
+    int id;
+    std::string name;
+    point position;
+    double weight;
+};
+
+struct empty {};
+
+struct wide {
+    int f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15,
+        f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29,
+        f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43,
+        f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57,
+        f58, f59;
+};
+
+} // namespace
+
+TR_AGGREGATE_TUPLE(point);
+TR_AGGREGATE_TUPLE(record);
+TR_AGGREGATE_TUPLE(empty);
+TR_AGGREGATE_TUPLE(wide);
+
+namespace {
+
+struct TestAggregate {
+    void test_size() {
+        static_assert(aggregate_size_v<point> == 2);
+        static_assert(aggregate_size_v<record> == 4);
+        static_assert(aggregate_size_v<empty> == 0);
+        static_assert(aggregate_size_v<wide> == 60);
+        static_assert(decltype(tr::length(std::declval<record &>()))::value ==
+                      4);
+    }
+
+    void test_at() {
+        static_assert(at_c<1>(point{1, 2}) == 2);
+        static_assert([] {
+            wide w{};
+            w.f37 = 37;
+            return at_c<37>(w);
+        }() == 37);
+
+        static_assert(type_c<decltype(at_c<1>(std::declval<record &>()))> ==
+                      type_c<std::string &>);
+        static_assert(
+            type_c<decltype(at_c<1>(std::declval<record const &>()))> ==
+            type_c<std::string const &>);
+        static_assert(type_c<decltype(at_c<1>(std::declval<record>()))> ==
+                      type_c<std::string &&>);
+        static_assert(type_c<decltype(at_c<2>(std::declval<record &>()))> ==
+                      type_c<point &>);
+    }
+
+    void test_algorithms() {
+        static_assert(tr::unpack(point{3, 4}, [](int x, int y) {
+                          return x * 10 + y;
+                      }) == 34);
+        static_assert(tr::fold_left(point{3, 4}, 0, [](int acc, int v) {
+                          return acc * 10 + v;
+                      }) == 34);
+        static_assert(at_c<0>(point{3, 4} | tr::reverse) == 4);
+    }
+};
+} // namespace
@@ -0,0 +1,79 @@
+#include <tr/view/columns_view.h>
+
+#include "runtime_tests.h"
+
+#include <tr/soa_vector.h>
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+using tr::soa_vector;
+using tr::type_c;
+
+using namespace tr::literals;
+
+namespace {
+
+struct TestColumnsView {
+    void test_types() {
+        using soa_t = soa_vector<int, float, std::string, std::uint8_t>;
+        soa_t v;
+
+        auto cols = v | tr::columns<0, 3>;
+        static_assert(type_c<decltype(*cols.begin())> ==
+                      type_c<tr::tuple<int &, std::uint8_t &>>);
+        static_assert(type_c<decltype(cols[0])> ==
+                      type_c<tr::tuple<int &, std::uint8_t &>>);
+
+        // The view doesn't own the store: it doesn't add constness.
+        static_assert(type_c<decltype(*std::as_const(cols).begin())> ==
+                      type_c<tr::tuple<int &, std::uint8_t &>>);
+
+        auto constCols = std::as_const(v) | tr::columns<2, 1>;
+        static_assert(type_c<decltype(*constCols.begin())> ==
+                      type_c<tr::tuple<std::string const &, float const &>>);
+
+        // An owning view over a temporary store.
+        auto owning = soa_t{} | tr::columns<1>;
+        static_assert(type_c<decltype(*owning.begin())> ==
+                      type_c<tr::tuple<float &>>);
+        static_assert(type_c<decltype(*std::as_const(owning).begin())> ==
+                      type_c<tr::tuple<float const &>>);
+    }
+
+    void test_iteration() {
+        soa_vector<int, float, std::string, char> v;
+        v.emplace_back(0, 0.f, "zero", 'a');
+        v.emplace_back(1, 1.f, "one", 'b');
+        v.emplace_back(2, 2.f, "two", 'c');
+
+        auto cols = v | tr::columns<0, 3>;
+        assert(cols.size() == 3);
+        assert(!cols.empty());
+
+        for (auto [i, c] : cols) {
+            c = static_cast<char>('x' + i);
+        }
+        assert(v[0][3_zuic] == 'x');
+        assert(v[2][3_zuic] == 'z');
+
+        int sum{};
+        for (auto [f, i] : v | tr::columns<1, 0>) {
+            sum += i + static_cast<int>(f);
+        }
+        assert(sum == 6);
+
+        assert(tr::get<0>(cols[1]) == 1);
+        assert(cols.end() - cols.begin() == 3);
+    }
+};
+} // namespace
+
+void run_columns_view_tests() {
+    TestColumnsView t;
+    t.test_iteration();
+}
@@ -0,0 +1,157 @@
+#include <tr/compressed_tuple.h>
+
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/macros.h>
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+using tr::compressed_tuple;
+using tr::type_c;
+
+using namespace tr::literals;
+
+namespace {
+
+struct alloc {};
+struct cmp {};
+struct policy {};
+struct final_policy final {};
+
+// Hand-written structs with the layout I expect from a compressed_tuple, i.e.
+// each distinct empty type is an empty base and all the other elements are
+// data members.
+struct empty_equivalent {};
+
+struct TR_EMPTY_BASES alloc_cmp_equivalent : alloc, cmp {};
+
+struct TR_EMPTY_BASES int_alloc_equivalent : alloc {
+    int Val_;
+};
+
+struct TR_EMPTY_BASES int_alloc_cmp_policy_equivalent : alloc, cmp, policy {
+    int Val_;
+};
+
+struct TR_EMPTY_BASES double_char_alloc_equivalent : alloc {
+    double Val0_;
+    char Val1_;
+};
+
+struct int_final_final_equivalent {
+    int Val_;
+    final_policy Policy0_;
+    final_policy Policy1_;
+};
+
+struct TestCompressedTuple {
+    void test_layout() {
+        static_assert(sizeof(compressed_tuple<>) == sizeof(empty_equivalent));
+        static_assert(sizeof(compressed_tuple<alloc>) ==
+                      sizeof(empty_equivalent));
+        static_assert(sizeof(compressed_tuple<alloc, alloc>) ==
+                      sizeof(empty_equivalent));
+        static_assert(sizeof(compressed_tuple<alloc, alloc, alloc, alloc>) ==
+                      sizeof(empty_equivalent));
+        static_assert(sizeof(compressed_tuple<alloc, cmp, alloc, cmp>) ==
+                      sizeof(alloc_cmp_equivalent));
+
+        static_assert(sizeof(compressed_tuple<int, alloc>) ==
+                      sizeof(int_alloc_equivalent));
+        static_assert(sizeof(compressed_tuple<alloc, int, alloc>) ==
+                      sizeof(int_alloc_equivalent));
+        static_assert(sizeof(compressed_tuple<alloc, alloc, int, alloc>) ==
+                      sizeof(int_alloc_equivalent));
+
+        static_assert(
+            sizeof(compressed_tuple<alloc, cmp, int, policy, cmp, alloc>) ==
+            sizeof(int_alloc_cmp_policy_equivalent));
+
+        static_assert(
+            sizeof(compressed_tuple<double, alloc, char, alloc, alloc>) ==
+            sizeof(double_char_alloc_equivalent));
+
+        // Final classes can't be compressed.
+        static_assert(
+            sizeof(compressed_tuple<int, final_policy, final_policy>) ==
+            sizeof(int_final_final_equivalent));
+
+        // References are never compressed.
+        static_assert(sizeof(compressed_tuple<alloc &, alloc &>) ==
+                      2 * sizeof(alloc *));
+
+        // tr::tuple can't compress duplicates.
+        static_assert(sizeof(tr::tuple<int, alloc, alloc>) >
+                      sizeof(compressed_tuple<int, alloc, alloc>));
+
+        using alloc_t = std::allocator<int>;
+        static_assert(sizeof(compressed_tuple<int *, alloc_t, alloc_t>) ==
+                      sizeof(int *));
+    }
+
+    void test_access() {
+        constexpr compressed_tuple<int, alloc, char, alloc> t{1, {}, 'a', {}};
+        static_assert(t[0_zuic] == 1);
+        static_assert(t[2_zuic] == 'a');
+        static_assert(&t[1_zuic] == &t[3_zuic]);
+
+        using tr::get;
+        static_assert(get<0>(t) == 1);
+        static_assert(get<2>(t) == 'a');
+
+        using tr::at_c;
+        static_assert(at_c<0>(t) == 1);
+        static_assert(&at_c<1>(t) == &at_c<3>(t));
+
+        static_assert(tr::length(t) == 4);
+
+        using tuple_t = std::remove_const_t<decltype(t)>;
+        static_assert(std::tuple_size_v<tuple_t> == 4);
+        static_assert(type_c<std::tuple_element_t<1, tuple_t>> ==
+                      type_c<alloc>);
+        static_assert(type_c<std::tuple_element_t<2, tuple_t>> ==
+                      type_c<char>);
+        static_assert(type_c<std::tuple_element_t<3, tuple_t>> ==
+                      type_c<alloc>);
+    }
+
+    void test_value_categories() {
+        compressed_tuple<std::string, alloc, alloc> t{};
+        static_assert(type_c<decltype(t[2_zuic])> == type_c<alloc &>);
+        static_assert(type_c<decltype(std::as_const(t)[2_zuic])> ==
+                      type_c<alloc const &>);
+        static_assert(type_c<decltype(std::move(t)[2_zuic])> ==
+                      type_c<alloc &&>);
+        static_assert(type_c<decltype(std::move(t)[0_zuic])> ==
+                      type_c<std::string &&>);
+    }
+
+    void test_structured_bindings() {
+        compressed_tuple t{1, alloc{}, alloc{}};
+        static_assert(type_c<decltype(t)> ==
+                      type_c<compressed_tuple<int, alloc, alloc>>);
+
+        auto &[i, a0, a1] = t;
+        static_assert(type_c<decltype(i)> == type_c<int>);
+        static_assert(type_c<decltype(a0)> == type_c<alloc>);
+        static_assert(type_c<decltype(a1)> == type_c<alloc>);
+    }
+
+    void test_assignment_and_swap() {
+        using tuple_t = compressed_tuple<std::string, alloc, alloc>;
+        tuple_t lhs{"hello", {}, {}};
+        tuple_t rhs{lhs};
+        rhs = lhs;
+        rhs = tuple_t{};
+
+        using std::swap;
+        swap(lhs, rhs);
+        static_assert(std::is_swappable_v<tuple_t>);
+    }
+};
+} // namespace
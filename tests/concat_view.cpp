@@ -0,0 +1,92 @@
+#include <tr/view/concat_view.h>
+
+#include <tr/algorithm/all_of.h>
+#include <tr/materialize.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/reverse_view.h>
+#include <tr/view/transform_view.h>
+
+#include <string>
+
+using tr::at_c;
+using tr::concat;
+using tr::materialize;
+using tr::type_c;
+
+namespace {
+
+template <typename Tuple0, typename Tuple1>
+constexpr bool equal(Tuple0 &&lhs, Tuple1 &&rhs) {
+    using tr::length, tr::all_of, tr::at;
+    auto indices = tr::indices_for(lhs);
+    return (length(lhs) == length(rhs)) &&
+           all_of(indices, [&](auto i) { return at(lhs, i) == at(rhs, i); });
+}
+
+/// @brief A type that can be neither copied nor moved.
+struct pinned {
+    int value;
+
+    constexpr explicit pinned(int v) noexcept : value{v} {}
+    pinned(pinned &&) = delete;
+};
+
+struct TestConcatView {
+    void test_concat() {
+        static constexpr int arr[]{1, 2};
+        static constexpr tr::tuple t{3, 4.5, '6'};
+
+        constexpr auto view = concat(arr, t, arr);
+        static_assert(view.size() == 7);
+        static_assert(equal(view, tr::tuple{1, 2, 3, 4.5, '6', 1, 2}));
+        static_assert(type_c<decltype(at_c<4>(view))> == type_c<char const &>);
+
+        static_assert(equal(arr | concat(t), tr::tuple{1, 2, 3, 4.5, '6'}));
+        static_assert(equal(arr | concat(t, arr) | tr::drop_c<4>,
+                            tr::tuple{'6', 1, 2}));
+        static_assert(
+            equal(concat(arr, t) | tr::reverse, tr::tuple{'6', 4.5, 3, 2, 1}));
+
+        // Empty inputs.
+        static_assert(concat().size() == 0);
+        static_assert(equal(concat(tr::tuple<>{}, arr, tr::tuple<>{}), arr));
+    }
+
+    void test_no_copies() {
+        tr::tuple<std::string, std::string> names{};
+        std::string more[]{"a", "b"};
+
+        auto view = concat(names, more);
+        static_assert(sizeof(view) == 2 * sizeof(void *));
+        static_assert(type_c<decltype(at_c<3>(view))> ==
+                      type_c<std::string &>);
+        static_assert(type_c<decltype(at_c<0>(std::move(view)))> ==
+                      type_c<std::string &>);
+
+        // R-values are moved into the view.
+        auto owning = concat(names, tr::tuple<std::string>{});
+        static_assert(type_c<decltype(at_c<2>(owning))> ==
+                      type_c<std::string &>);
+        static_assert(type_c<decltype(at_c<2>(std::move(owning)))> ==
+                      type_c<std::string &&>);
+    }
+
+    void test_materialize() {
+        static constexpr int arr[]{1, 2};
+        static constexpr tr::tuple t{3, 4.5};
+
+        constexpr auto owned = concat(arr, t) | materialize;
+        static_assert(type_c<decltype(owned)> ==
+                      type_c<tr::tuple<int, int, int, double> const>);
+        static_assert(equal(owned, tr::tuple{1, 2, 3, 4.5}));
+
+        // Prvalues are constructed in place.
+        constexpr auto pins =
+            materialize(arr | tr::transform([](int i) { return pinned{i}; }));
+        static_assert(at_c<1>(pins).value == 2);
+    }
+};
+} // namespace
@@ -0,0 +1,91 @@
+#include <tr/view/filter_types_view.h>
+#include <tr/view/group_by_type.h>
+
+#include <tr/algorithm/fold_left.h>
+#include <tr/at.h>
+#include <tr/simd.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/view/drop_view.h>
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using tr::at_c;
+using tr::filter_types;
+using tr::group_by_type;
+using tr::type_c;
+
+namespace {
+
+template <typename T>
+using is_int = std::is_same<T, int>;
+
+template <typename T>
+struct always : std::true_type {};
+
+template <typename T>
+struct never : std::false_type {};
+
+template <typename View>
+using indices_of_t = typename View::base_t::index_sequence_t;
+
+struct TestFilterTypesView {
+    void test_filter_types() {
+        using record_t = tr::tuple<int, std::string, double, char, std::string>;
+
+        using arith_t = decltype(std::declval<record_t &>() |
+                                 filter_types<std::is_arithmetic>);
+        static_assert(type_c<indices_of_t<arith_t>> ==
+                      type_c<std::index_sequence<0, 2, 3>>);
+
+        using all_t =
+            decltype(std::declval<record_t &>() | filter_types<always>);
+        static_assert(type_c<indices_of_t<all_t>> ==
+                      type_c<std::index_sequence<0, 1, 2, 3, 4>>);
+
+        using none_t =
+            decltype(std::declval<record_t &>() | filter_types<never>);
+        static_assert(type_c<indices_of_t<none_t>> ==
+                      type_c<std::index_sequence<>>);
+
+        static constexpr tr::tuple t{1, 2.5, 3, 'a', 4};
+        constexpr auto ints = t | filter_types<is_int>;
+        static_assert(ints.size() == 3);
+        static_assert(tr::fold_left(ints, 0, std::plus<>{}) == 8);
+        static_assert(type_c<decltype(at_c<2>(ints))> == type_c<int const &>);
+
+        // Cv-ref qualifiers are ignored.
+        static_assert(tr::fold_left(t | tr::drop_c<1> | filter_types<is_int>,
+                                    0, std::plus<>{}) == 7);
+    }
+
+    void test_group_by_type() {
+        static constexpr tr::tuple t{1, 2.5, 3, 'a', 4.5, 5};
+        constexpr auto groups = t | group_by_type;
+
+        static_assert(tr::length(groups) == 3);
+        static_assert(tr::fold_left(at_c<0>(groups), 0, std::plus<>{}) == 9);
+        static_assert(tr::fold_left(at_c<1>(groups), 0., std::plus<>{}) ==
+                      7.0);
+        static_assert(at_c<0>(at_c<2>(groups)) == 'a');
+
+        // Each group is homogeneous.
+        static_assert(tr::is_simd_tuple_v<
+                      tr::detail::remove_cvref_t<decltype(at_c<0>(groups))>>);
+
+        constexpr auto written = [] {
+            tr::tuple<int, double, int> u{};
+            auto ints = at_c<0>(u | group_by_type);
+            at_c<1>(ints) = 42;
+            return at_c<2>(u);
+        }();
+        static_assert(written == 42);
+
+        static_assert(tr::length(tr::tuple<>{} | filter_types<always>) == 0);
+    }
+};
+} // namespace
@@ -1,6 +1,7 @@
 #include <tr/algorithm/fold_left.h>
 #include <tr/algorithm/fold_left_first.h>
 
+#include <tr/overloaded.h>
 #include <tr/tuple.h>
 #include <tr/tuple_protocol/std_integer_sequence.h>
 #include <tr/value_constant.h>
@@ -12,6 +13,21 @@
 
 namespace {
 
+struct step0 {
+    float x;
+    int i;
+};
+
+struct step1 {
+    step0 prev;
+    char c;
+};
+
+struct step2 {
+    step1 prev;
+    char const *str;
+};
+
 struct swallow {
     template <typename... Args>
     constexpr void operator()(Args &&...) const noexcept {}
@@ -104,6 +120,65 @@ struct TestFoldLeft {
                 [](Accumulator acc, int i) { return acc.add(i); });
             static_assert(res2.Acc_ == 6);
         }
+
+        {
+            // The accumulator type doesn't change: the fold is flat.
+            constexpr auto sum =
+                tr::fold_left(tr::tuple{1, 2l, 3u}, 0, [](int acc, auto x) {
+                    return acc + static_cast<int>(x);
+                });
+            static_assert(std::is_same_v<decltype(sum), int const>);
+            static_assert(sum == 6);
+
+            constexpr auto first = tr::fold_left_first(
+                tr::tuple{1, 2, 3}, [](int acc, int x) { return acc + x; });
+            static_assert(first == 6);
+
+            auto concat = [](std::string acc, char c) { return acc + c; };
+
+            std::string s;
+            using res_t =
+                decltype(tr::fold_left(tr::tuple{'a', 'b'}, s, concat));
+            static_assert(std::is_same_v<res_t, std::string>);
+        }
+
+        {
+            // Each step returns a reference to the accumulator.
+            auto append = [](std::string &acc, auto c) -> std::string & {
+                return acc += c;
+            };
+
+            std::string s;
+            using res_t =
+                decltype(tr::fold_left(tr::tuple{'a', "bc"}, s, append));
+            static_assert(std::is_same_v<res_t, std::string &>);
+        }
+
+        {
+            // The accumulator type changes at each step.
+            auto pair = [](auto acc, auto x) { return tr::tuple{acc, x}; };
+            using res_t =
+                decltype(tr::fold_left(tr::tuple{1, 'a'}, 0.f, pair));
+            static_assert(
+                std::is_same_v<res_t,
+                               tr::tuple<tr::tuple<float, int>, char>>);
+        }
+
+        {
+            // Each step only accepts the accumulator of the previous one: the
+            // check for a flat fold mustn't try the later steps on the first
+            // accumulator.
+            constexpr auto res = tr::fold_left(
+                tr::tuple<int, char, char const *>{1, 'c', "str"}, 1.f,
+                tr::overloaded{
+                    [](float x, int i) { return step0{x, i}; },
+                    [](step0 prev, char c) { return step1{prev, c}; },
+                    [](step1 prev, char const *str) {
+                        return step2{prev, str};
+                    }});
+            static_assert(std::is_same_v<decltype(res), step2 const>);
+            static_assert(res.prev.prev.i == 1 && res.prev.c == 'c');
+        }
     }
 };
 } // namespace
@@ -0,0 +1,61 @@
+#include <tr/algorithm/fold_tree.h>
+
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/view/drop_view.h>
+
+#include <functional>
+#include <string>
+
+using tr::fold_tree;
+using tr::tuple;
+using tr::type_c;
+
+namespace {
+
+struct TestFoldTree {
+    void test() {
+        {
+            constexpr auto sum = fold_tree(tuple{1, 2l, 3, 4}, std::plus{});
+            static_assert(type_c<decltype(sum)> == type_c<long const>);
+            static_assert(sum == 10);
+
+            constexpr auto sumInit = fold_tree(tuple{1, 2, 3}, 4, std::plus{});
+            static_assert(sumInit == 10);
+
+            constexpr auto onlyInit = fold_tree(tuple{}, 4, std::plus{});
+            static_assert(onlyInit == 4);
+        }
+
+        {
+            constexpr auto max =
+                fold_tree(std::make_index_sequence<9>{} | tr::drop_c<1>,
+                          [](auto x, auto y) { return x < y ? y : x; });
+            static_assert(max == 8);
+        }
+
+        {
+            // The operator must be associative, not commutative: the order
+            // of the elements is kept.
+            auto concat = [](std::string lhs, std::string const &rhs) {
+                return lhs + rhs;
+            };
+
+            using res_t = decltype(fold_tree(tuple<std::string, char const *>{},
+                                             std::string{}, concat));
+            static_assert(type_c<res_t> == type_c<std::string>);
+        }
+
+        {
+            // A single element is forwarded.
+            int i{};
+            static_assert(type_c<decltype(fold_tree(tuple<int &>{i},
+                                                    std::plus{}))> ==
+                          type_c<int &>);
+            static_assert(type_c<decltype(fold_tree(tuple{1}, std::plus{}))> ==
+                          type_c<int>);
+        }
+    }
+};
+} // namespace
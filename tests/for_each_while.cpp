@@ -0,0 +1,160 @@
+#include <tr/algorithm/fold_left_while.h>
+#include <tr/algorithm/for_each_while.h>
+
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+#include <tr/value_constant.h>
+#include <tr/view/drop_view.h>
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+using tr::fold_left_while;
+using tr::for_each_while;
+using tr::tuple;
+using tr::type_c;
+using tr::value_c;
+
+namespace {
+
+struct incomplete;
+
+struct TestForEachWhile {
+    void test_for_each_while() {
+        {
+            constexpr int arr[]{1, 2, 0, 4};
+            constexpr auto visitAll =
+                for_each_while(arr | tr::drop_c<3>, [](int i) { return i; });
+            static_assert(visitAll);
+
+            constexpr auto stopped = [&arr] {
+                int visited{};
+                bool const res = for_each_while(arr, [&](int i) {
+                    ++visited;
+                    return i != 0;
+                });
+                return !res && visited == 3;
+            }();
+            static_assert(stopped);
+        }
+
+        {
+            // The stop decision is a compile-time constant: the elements after
+            // `incomplete *` are never visited.
+            auto isNotPointer = [](auto x) {
+                static_assert(!std::is_same_v<decltype(x), double>);
+                return value_c<!std::is_pointer_v<decltype(x)>>;
+            };
+
+            tuple<int, incomplete *, double> t{};
+            using res_t = decltype(for_each_while(t, isNotPointer));
+            static_assert(type_c<res_t> == type_c<tr::value_constant<false>>);
+
+            using all_t = decltype(for_each_while(tuple<int>{}, isNotPointer));
+            static_assert(type_c<all_t> == type_c<tr::value_constant<true>>);
+        }
+
+        static_assert(for_each_while(tuple{}, [] { /* unevaluated */ }),
+                      "tr::for_each_while is true on an empty tuple");
+
+        {
+            // A runtime stop decision doesn't take an instantiation per
+            // element: long tuples are fine.
+            constexpr auto visited = [] {
+                int arr[1024]{};
+                arr[1000] = 1;
+                std::size_t count{};
+                bool const all = for_each_while(arr, [&count](int i) {
+                    ++count;
+                    return i == 0;
+                });
+                return all ? 0 : count;
+            }();
+            static_assert(visited == 1001);
+        }
+    }
+
+    void test_fold_left_while() {
+        {
+            // Parse digits, until a character isn't one.
+            auto parseDigit = [](std::optional<int> acc,
+                                 char c) -> std::optional<int> {
+                if (c < '0' || c > '9') {
+                    return std::nullopt;
+                }
+                return *acc * 10 + (c - '0');
+            };
+
+            auto const res = fold_left_while(tuple{'4', '2'},
+                                             std::optional<int>{0}, parseDigit);
+            static_assert(type_c<decltype(res)> ==
+                          type_c<std::optional<int> const>);
+
+            constexpr auto parsed = [&parseDigit] {
+                return fold_left_while(tuple{'4', '2'}, std::optional<int>{0},
+                                       parseDigit);
+            }();
+            static_assert(parsed == 42);
+
+            constexpr auto stopped = [&parseDigit] {
+                int visited{};
+                auto const count = [&](std::optional<int> acc, char c) {
+                    ++visited;
+                    return parseDigit(acc, c);
+                };
+                auto const res = fold_left_while(
+                    tuple{'4', 'x', '2'}, std::optional<int>{0}, count);
+                return !res && visited == 2;
+            }();
+            static_assert(stopped);
+        }
+
+        {
+            // A long fold, with a runtime stop decision.
+            constexpr auto last = [] {
+                int arr[1024]{};
+                for (int i{}; i != 1024; ++i) {
+                    arr[i] = i;
+                }
+                int visited{};
+                auto const res =
+                    fold_left_while(arr, 1, [&visited](int acc, int i) {
+                        visited = i;
+                        return i < 100 ? acc + i : 0;
+                    });
+                return res == 0 ? visited : -1;
+            }();
+            static_assert(last == 100);
+        }
+
+        {
+            constexpr auto sum =
+                fold_left_while(tuple{1, 2, 3}, 0, [](int acc, int x) {
+                    return acc + x;
+                });
+            static_assert(sum == 6);
+
+            // Stop as soon as a step yields 0.
+            constexpr auto zero =
+                fold_left_while(tuple{1, -1, 3}, 0, [](int acc, int x) {
+                    return acc + x;
+                });
+            static_assert(zero == 0);
+        }
+
+        {
+            // A step yields a compile-time false: the following elements are
+            // never visited.
+            auto isComplete = [](auto, auto *x) {
+                return value_c<tr::detail::is_complete_v<decltype(*x)>>;
+            };
+
+            using res_t = decltype(fold_left_while(
+                tuple<int *, incomplete *, incomplete *>{}, tr::true_c,
+                isComplete));
+            static_assert(type_c<res_t> == type_c<tr::value_constant<false>>);
+        }
+    }
+};
+} // namespace
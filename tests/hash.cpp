@@ -0,0 +1,95 @@
+#include <tr/hash.h>
+
+#include "runtime_tests.h"
+
+#include <tr/tuple.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+
+using tr::tuple;
+
+namespace {
+
+struct TestHash {
+    void test_bytes_path() {
+        using tr::detail::is_bytewise_hashable;
+
+        static_assert(
+            is_bytewise_hashable<tuple<std::int32_t, std::int32_t>>());
+        static_assert(is_bytewise_hashable<std::uint32_t[4]>());
+        static_assert(is_bytewise_hashable<
+                      tuple<std::uint32_t, std::uint32_t, std::uint64_t>>());
+
+        // Padding, or scalars with several representations of a value.
+        static_assert(!is_bytewise_hashable<tuple<char, std::int64_t>>());
+        static_assert(!is_bytewise_hashable<tuple<double, double>>());
+        static_assert(!is_bytewise_hashable<tuple<std::string>>());
+    }
+
+    void test_equal_elements() {
+        tr::hash<tuple<int, int>> const h;
+        assert(h(tuple{1, 2}) == h(tuple{1, 2}));
+        assert(h(tuple{1, 2}) != h(tuple{2, 1}));
+
+        // Hashed element by element, with `-0.` hashing as `0.`.
+        tr::hash<tuple<double, char>> const hd;
+        assert(hd(tuple{-0., 'a'}) == hd(tuple{0., 'a'}));
+
+        tr::hash<> const any;
+        assert(any(std::pair{1, std::string{"a"}}) ==
+               any(std::pair{1, std::string{"a"}}));
+        assert(any(std::tuple{1, 2.5}) == any(std::tuple{1, 2.5}));
+
+        int const arr[3]{1, 2, 3};
+        int const same[3]{1, 2, 3};
+        assert(any(arr) == any(same));
+    }
+
+    void test_unordered_set() {
+        std::unordered_set<tuple<int, int>, tr::hash<>> set;
+        set.insert(tuple{1, 2});
+        set.insert(tuple{2, 1});
+        set.insert(tuple{1, 2});
+        assert(set.size() == 2);
+        assert(set.count(tuple{2, 1}) == 1);
+        assert(set.count(tuple{2, 2}) == 0);
+
+        std::unordered_set<std::tuple<int, std::string>, tr::hash<>> strings;
+        strings.emplace(1, "one");
+        strings.emplace(1, "one");
+        assert(strings.size() == 1);
+    }
+
+    void test_batch() {
+        using packed_t = tuple<std::uint32_t, std::uint32_t>;
+        using padded_t = tuple<std::uint16_t, std::uint64_t>;
+
+        packed_t const packed[3]{{1, 2}, {3, 4}, {5, 6}};
+        padded_t const padded[3]{{1, 2}, {3, 4}, {5, 6}};
+        std::size_t out[3];
+
+        tr::hash_batch(packed, 3, out);
+        for (std::size_t i{}; i != 3; ++i) {
+            assert(out[i] == tr::hash<packed_t>{}(packed[i]));
+        }
+        tr::hash_batch(padded, 3, out);
+        for (std::size_t i{}; i != 3; ++i) {
+            assert(out[i] == tr::hash<padded_t>{}(padded[i]));
+        }
+    }
+};
+
+} // namespace
+
+void run_hash_tests() {
+    TestHash t;
+    t.test_equal_elements();
+    t.test_unordered_set();
+    t.test_batch();
+}
@@ -8,6 +8,7 @@
 #include <tr/invoke.h>
 #include <tr/overloaded.h>
 #include <tr/tuple.h>
+#include <tr/tuple_protocol/aggregate.h>
 #include <tr/tuple_protocol/built_in_array.h>
 #include <tr/tuple_protocol/std_integer_sequence.h>
 #include <tr/tuple_protocol/std_pair.h>
@@ -18,6 +19,8 @@
 #include <tr/view/reverse_view.h>
 #include <tr/view/tuple_view.h>
 
+#include "runtime_tests.h"
+
 #include <algorithm>
 #include <array>
 #include <cassert>
@@ -31,8 +34,6 @@
 
 // TODO:
 // tr::tuple
-// tr::compressed_tuple
-// tr::span (with unpack capabilities)
 // try and add a tag type to ebo and see if compressing capabilities increase.
 
 // TODO:
@@ -142,47 +143,15 @@ struct DBRow {
 };
 } // namespace
 
-namespace tr {
-
-template <>
-struct length_impl<DBRow> {
-    template <typename Sized>
-    [[nodiscard]] constexpr static auto apply(Sized &&) noexcept
-        -> value_constant<4> {
-        return {};
-    }
-};
-
-template <>
-struct at_impl<DBRow> {
-    template <typename Iterable, typename Idx>
-    static constexpr decltype(auto) apply(Iterable &&arr, Idx) noexcept {
-
-        tr::tuple const memPtrs{&DBRow::id, &DBRow::name, &DBRow::birthCity,
-                                &DBRow::birthCountry};
-        return tr::invoke(memPtrs[Idx{}], static_cast<Iterable &&>(arr));
-
-        //if constexpr (Idx{} == 0) {
-        //    return arr.id;
-        //}
-
-        //if constexpr (Idx{} == 1) {
-        //    return arr.name;
-        //}
-
-        //if constexpr (Idx{} == 2) {
-        //    return arr.birthCity;
-        //}
-
-        //if constexpr (Idx{} == 3) {
-        //    return arr.birthCountry;
-        //}
-    }
-};
-
-} // namespace tr
+TR_AGGREGATE_TUPLE(DBRow);
 
 int main() {
+    run_columns_view_tests();
+    run_hash_tests();
+    run_record_file_tests();
+    run_serialize_tests();
+    run_simd_tests();
+    run_soa_vector_tests();
 
     {
         // int t[]{0, 1, 2, 3, 4};
@@ -0,0 +1,70 @@
+#include <tr/detail/nth_type.h>
+
+#include <tr/at.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/value_constant.h>
+#include <tr/value_sequence.h>
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+using tr::type_c;
+using tr::detail::nth_type_t;
+using tr::detail::nth_value_v;
+
+namespace {
+
+struct incomplete;
+
+struct TestNthType {
+    void test_types() {
+        static_assert(type_c<nth_type_t<0, int>> == type_c<int>);
+        static_assert(type_c<nth_type_t<0, int, char, void>> == type_c<int>);
+        static_assert(type_c<nth_type_t<1, int, char, void>> == type_c<char>);
+        static_assert(type_c<nth_type_t<2, int, char, void>> == type_c<void>);
+
+        // Types that can't be returned, nor be complete.
+        static_assert(type_c<nth_type_t<1, int, int[3]>> == type_c<int[3]>);
+        static_assert(type_c<nth_type_t<1, int, void()>> == type_c<void()>);
+        static_assert(type_c<nth_type_t<0, incomplete, int>> ==
+                      type_c<incomplete>);
+
+        // Qualifiers are kept.
+        static_assert(type_c<nth_type_t<1, int, int const &>> ==
+                      type_c<int const &>);
+        static_assert(type_c<nth_type_t<0, int &&, int>> == type_c<int &&>);
+    }
+
+    void test_values() {
+        static_assert(nth_value_v<0, 1> == 1);
+        static_assert(nth_value_v<2, 1, 2, 3> == 3);
+
+        // Heterogeneous values keep their type.
+        static_assert(type_c<decltype(nth_value_v<1, 1, 'a', 2u>)> ==
+                      type_c<char const>);
+        static_assert(nth_value_v<1, 1, 'a', 2u> == 'a');
+    }
+
+    void test_long_packs() {
+        using seq_t = std::make_index_sequence<1024>;
+        static_assert(decltype(tr::at(seq_t{}, tr::zuic<1000>))::value == 1000);
+    }
+
+    void test_tuple_element() {
+        using tuple_t = tr::tuple<int, char &, double const>;
+        static_assert(type_c<std::tuple_element_t<0, tuple_t>> ==
+                      type_c<int>);
+        static_assert(type_c<std::tuple_element_t<1, tuple_t>> ==
+                      type_c<char &>);
+        static_assert(type_c<std::tuple_element_t<2, tuple_t>> ==
+                      type_c<double const>);
+
+        using seq_t = tr::value_tuple_constant<1, 'a'>;
+        static_assert(type_c<std::tuple_element_t<1, seq_t>> ==
+                      type_c<tr::value_constant<'a'>>);
+    }
+};
+} // namespace
@@ -0,0 +1,137 @@
+#include <tr/packed_tuple.h>
+
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+#include <tr/type_pack.h>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+
+using tr::packed_tuple;
+using tr::type_c;
+using tr::type_pack;
+
+using namespace tr::literals;
+
+namespace {
+
+struct empty {};
+
+struct alignas(16) over_aligned {
+    char Data_;
+};
+
+/// @brief Check `packed_tuple<Ts...>` is never larger than `tuple<Ts...>`.
+template <typename... Ts>
+static constexpr bool not_larger_v{sizeof(packed_tuple<Ts...>) <=
+                                   sizeof(tr::tuple<Ts...>)};
+
+template <typename T0, typename T1, typename... Ts>
+constexpr bool check_row(type_pack<Ts...>) noexcept {
+    return (not_larger_v<T0, T1, Ts, char> && ...) &&
+           (not_larger_v<Ts, T0, char, T1> && ...);
+}
+
+template <typename T0, typename... T1s, typename... Ts>
+constexpr bool check_plane(type_pack<T1s...>, type_pack<Ts...> ts) noexcept {
+    return (check_row<T0, T1s>(ts) && ...);
+}
+
+/// @brief Check every combination of three types out of `Ts...` (plus a
+/// `char`, to make sure some padding is there).
+template <typename... Ts>
+constexpr bool check_matrix(type_pack<Ts...> ts) noexcept {
+    return (check_plane<Ts>(ts, ts) && ...);
+}
+
+using matrix_t = type_pack<char, std::int16_t, int, double, long long, empty,
+                           over_aligned, int &, char[3], std::uint8_t[5]>;
+
+static_assert(check_matrix(matrix_t{}));
+
+struct TestPackedTuple {
+    void test_size() {
+        static_assert(sizeof(tr::tuple<char, double, char, int>) == 24);
+        static_assert(sizeof(packed_tuple<char, double, char, int>) == 16);
+
+        static_assert(sizeof(packed_tuple<char, double>) == sizeof(double) * 2);
+        static_assert(sizeof(packed_tuple<char, int, char, int, char, int>) ==
+                      sizeof(int) * 4);
+
+        static_assert(sizeof(packed_tuple<empty, char, double>) ==
+                      sizeof(double) * 2);
+    }
+
+    void test_logical_indices() {
+        constexpr packed_tuple<char, double, char, int> t{'a', 1.5, 'b', 2};
+
+        static_assert(t[0_zuic] == 'a');
+        static_assert(t[1_zuic] == 1.5);
+        static_assert(t[2_zuic] == 'b');
+        static_assert(t[3_zuic] == 2);
+
+        using tr::get;
+        static_assert(get<0>(t) == 'a');
+        static_assert(get<3>(t) == 2);
+
+        using tr::at_c;
+        static_assert(at_c<1>(t) == 1.5);
+        static_assert(at_c<2>(t) == 'b');
+
+        static_assert(tr::length(t) == 4);
+
+        using tuple_t = std::remove_const_t<decltype(t)>;
+        static_assert(std::tuple_size_v<tuple_t> == 4);
+        static_assert(type_c<std::tuple_element_t<0, tuple_t>> == type_c<char>);
+        static_assert(type_c<std::tuple_element_t<1, tuple_t>> ==
+                      type_c<double>);
+        static_assert(type_c<std::tuple_element_t<3, tuple_t>> == type_c<int>);
+    }
+
+    void test_value_categories() {
+        packed_tuple<int, std::string> t{};
+        static_assert(type_c<decltype(t[0_zuic])> == type_c<int &>);
+        static_assert(type_c<decltype(std::as_const(t)[1_zuic])> ==
+                      type_c<std::string const &>);
+        static_assert(type_c<decltype(std::move(t)[1_zuic])> ==
+                      type_c<std::string &&>);
+
+        int i{};
+        packed_tuple<char, int &> ref{'a', i};
+        static_assert(type_c<decltype(ref[1_zuic])> == type_c<int &>);
+    }
+
+    void test_structured_bindings() {
+        packed_tuple t{'a', 1.5, 2};
+        static_assert(type_c<decltype(t)> ==
+                      type_c<packed_tuple<char, double, int>>);
+
+        auto &[c, d, i] = t;
+        static_assert(type_c<decltype(c)> == type_c<char>);
+        static_assert(type_c<decltype(d)> == type_c<double>);
+        static_assert(type_c<decltype(i)> == type_c<int>);
+    }
+
+    void test_assignment_and_swap() {
+        using tuple_t = packed_tuple<char, std::string, double>;
+        tuple_t lhs{'a', "hello", 1.};
+        tuple_t rhs{lhs};
+        rhs = lhs;
+        rhs = tuple_t{};
+
+        using std::swap;
+        swap(lhs, rhs);
+        static_assert(std::is_swappable_v<tuple_t>);
+    }
+
+    void test_triviality() {
+        using tuple_t = packed_tuple<char, double, empty, int>;
+        static_assert(std::is_trivially_copyable_v<tuple_t>);
+        static_assert(std::is_trivially_destructible_v<tuple_t>);
+    }
+};
+} // namespace
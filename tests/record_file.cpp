@@ -0,0 +1,203 @@
+#include <tr/record_file.h>
+
+#include "runtime_tests.h"
+
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+#include <tr/unpack.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+using tr::at_c;
+using tr::record_file;
+using tr::record_layout;
+using tr::record_view;
+using tr::tuple;
+using tr::type_c;
+
+namespace {
+
+using point_t = tuple<float, float>;
+using row_t = tuple<std::int64_t, double, point_t, std::uint32_t>;
+
+/// @brief A path in the temporary directory, unique to this process (so that
+/// the tests may run in parallel).
+[[nodiscard]] auto temp_path(char const *name) -> std::string {
+#if defined(_WIN32)
+    auto const pid = _getpid();
+#else
+    auto const pid = getpid();
+#endif
+    return (std::filesystem::temp_directory_path() /
+            ("tr_" + std::to_string(pid) + "_" + name))
+        .string();
+}
+
+[[nodiscard]] auto make_rows() -> std::vector<row_t> {
+    std::vector<row_t> rows;
+    for (std::uint32_t i{}; i != 100; ++i) {
+        rows.push_back(row_t{-static_cast<std::int64_t>(i), i * 0.5,
+                             point_t{1.f * i, 2.f * i}, i});
+    }
+    return rows;
+}
+
+/// @brief Open the file at `path` as a `File`, and get the message of the
+/// error this throws (empty if it doesn't).
+template <typename File>
+[[nodiscard]] auto open_error(std::string const &path) -> std::string {
+    try {
+        File file{path};
+    } catch (std::runtime_error const &e) {
+        return e.what();
+    }
+    return {};
+}
+
+[[nodiscard]] auto contains(std::string const &str, char const *part)
+    -> bool {
+    return str.find(part) != std::string::npos;
+}
+
+struct TestRecordFile {
+    void test_record_view() {
+        using view_t = record_view<row_t>;
+
+        static_assert(decltype(tr::length(std::declval<view_t>()))::value ==
+                      4);
+
+        // Scalars are decoded by value, nested tuples are nested views.
+        static_assert(type_c<decltype(at_c<1>(std::declval<view_t>()))> ==
+                      type_c<double>);
+        static_assert(type_c<decltype(at_c<2>(std::declval<view_t>()))> ==
+                      type_c<record_view<point_t>>);
+
+        // Schemas only depend on the serialized form.
+        static_assert(tr::detail::record_schema_v<tuple<int, float>> ==
+                      tr::detail::record_schema_v<tuple<int &, float>>);
+        static_assert(tr::detail::record_schema_v<tuple<int, float>> !=
+                      tr::detail::record_schema_v<tuple<float, int>>);
+        static_assert(tr::detail::record_schema_v<tuple<int, int>> !=
+                      tr::detail::record_schema_v<tuple<tuple<int>, int>>);
+    }
+
+    void test_rows() {
+        auto const path = temp_path("test_rows.rec");
+        auto const rows = make_rows();
+        tr::write_record_file(path, rows);
+
+        record_file<row_t> file{path};
+        assert(file.size() == rows.size());
+        assert(at_c<0>(file[7]) == -7);
+        assert(at_c<1>(at_c<2>(file[7])) == 14.f);
+        assert(tr::unpack(file[3], [](auto id, auto, auto, auto n) {
+                   return id + n;
+               }) == 0);
+
+        double sum{};
+        for (auto row : file) {
+            sum += at_c<1>(row);
+        }
+        assert(sum == 99 * 100 / 4.);
+        assert(at_c<3>(file[99].load()) == 99);
+
+        std::remove(path.c_str());
+    }
+
+    void test_columns() {
+        auto const path = temp_path("test_columns.rec");
+        auto const rows = make_rows();
+        tr::write_record_file<record_layout::columns>(path, rows);
+
+        record_file<row_t, record_layout::columns> file{path};
+        assert(file.size() == rows.size());
+        assert(at_c<0>(file[42]) == -42);
+        assert(at_c<0>(at_c<2>(file[42])) == 42.f);
+
+        auto const row = file[42].load();
+        assert(at_c<1>(row) == 21. && at_c<3>(row) == 42);
+
+        std::remove(path.c_str());
+    }
+
+    void test_errors() {
+        auto const rowsPath = temp_path("test_rows_errors.rec");
+        auto const columnsPath = temp_path("test_columns_errors.rec");
+        auto const rows = make_rows();
+        tr::write_record_file(rowsPath, rows);
+        tr::write_record_file<record_layout::columns>(columnsPath, rows);
+
+        // Template arguments with commas can't be passed to `assert`.
+        using rows_file = record_file<row_t>;
+        using columns_file = record_file<row_t, record_layout::columns>;
+        using other_rows_file = record_file<point_t>;
+        using other_columns_file =
+            record_file<point_t, record_layout::columns>;
+
+        assert(open_error<rows_file>(rowsPath).empty());
+        assert(open_error<columns_file>(columnsPath).empty());
+        assert(contains(open_error<columns_file>(rowsPath),
+                        "layout mismatch"));
+        assert(contains(open_error<rows_file>(columnsPath),
+                        "layout mismatch"));
+        assert(contains(open_error<other_rows_file>(rowsPath),
+                        "schema mismatch"));
+        assert(contains(open_error<other_columns_file>(columnsPath),
+                        "schema mismatch"));
+
+        // Missing records.
+        auto const size = std::filesystem::file_size(rowsPath);
+        std::filesystem::resize_file(rowsPath, size - 1);
+        assert(contains(open_error<rows_file>(rowsPath), "truncated file"));
+        std::filesystem::resize_file(columnsPath, size - 1);
+        assert(contains(open_error<columns_file>(columnsPath),
+                        "truncated file"));
+
+        // Not a record file, or no file at all.
+        auto const textPath = temp_path("test_text.rec");
+        std::FILE *text = std::fopen(textPath.c_str(), "w");
+        std::fputs("not a record file, but longer than the header of one, "
+                   "which is 64 bytes long",
+                   text);
+        std::fclose(text);
+        assert(contains(open_error<rows_file>(textPath),
+                        "not a record file"));
+
+        std::remove(textPath.c_str());
+        std::remove(rowsPath.c_str());
+        std::remove(columnsPath.c_str());
+
+        bool missing{};
+        try {
+            rows_file file{rowsPath};
+        } catch (std::system_error const &) {
+            missing = true;
+        }
+        assert(missing);
+    }
+};
+
+} // namespace
+
+void run_record_file_tests() {
+    TestRecordFile t;
+    t.test_rows();
+    t.test_columns();
+    t.test_errors();
+}
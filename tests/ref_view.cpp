@@ -0,0 +1,79 @@
+#include <tr/view/ref_view.h>
+
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/reverse_view.h>
+#include <tr/view/tuple_view.h>
+
+#include <array>
+#include <utility>
+
+using tr::drop_c;
+using tr::ic;
+using tr::reverse;
+using tr::type_c;
+
+namespace {
+
+struct move_only {
+    constexpr explicit move_only(int v) noexcept : value{v} {}
+    move_only(move_only const &) = delete;
+    constexpr move_only(move_only &&) noexcept = default;
+
+    int value;
+};
+
+using big_t = std::array<double, 64>;
+using big_tuple_t = tr::tuple<big_t, big_t, big_t>;
+
+struct TestRefView {
+    void test_ref() {
+        static constexpr int t[]{1, 2, 3};
+
+        constexpr auto r = tr::ref(t);
+        static_assert(type_c<decltype(r)> ==
+                      type_c<tr::ref_view<int const[3]> const>);
+        static_assert(r.size() == 3);
+        static_assert(r[ic<2>] == 3);
+        static_assert((r | reverse | drop_c<1>)[ic<0>] == 2);
+        static_assert(&(r | reverse)[ic<0>] == &t[2]);
+    }
+
+    void test_sizeof() {
+        big_tuple_t t{};
+
+        // Views over l-values refer to them.
+        static_assert(sizeof(t | reverse) == sizeof(void *));
+        static_assert(sizeof(t | reverse | drop_c<1> | reverse) ==
+                      sizeof(void *));
+
+        // Views over r-values own them, once.
+        static_assert(sizeof(big_tuple_t{} | reverse) == sizeof(big_tuple_t));
+        static_assert(sizeof(big_tuple_t{} | reverse | drop_c<1> | reverse) ==
+                      sizeof(big_tuple_t));
+
+        // Borrowed views only hold a pointer.
+        static_assert(sizeof(tr::ref(t)) == sizeof(void *));
+        static_assert(sizeof(tr::ref(t) | reverse | drop_c<1>) ==
+                      sizeof(void *));
+    }
+
+    void test_no_copy() {
+        // Piping r-values only moves them: this compiles with move-only
+        // elements.
+        using tuple_t = tr::tuple<move_only, move_only, move_only>;
+        constexpr int second =
+            (tuple_t{move_only{1}, move_only{2}, move_only{3}} | reverse |
+             drop_c<1>)[ic<0>]
+                .value;
+        static_assert(second == 2);
+
+        static_assert(
+            type_c<decltype(tuple_t{move_only{1}, move_only{2},
+                                    move_only{3}} |
+                            reverse | drop_c<1>)> ==
+            type_c<tr::tuple_view<tuple_t, std::index_sequence<1, 0>>>);
+    }
+};
+} // namespace
@@ -0,0 +1,99 @@
+#include <tr/reflect.h>
+
+#include <tr/algorithm/fold_left.h>
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/type_constant.h>
+#include <tr/unpack.h>
+
+#include <string_view>
+#include <utility>
+
+using tr::at_c;
+using tr::field_count_v;
+using tr::field_name_v;
+using tr::type_c;
+
+namespace {
+
+class order {
+  public:
+    constexpr order(int id, double price, int qty) noexcept
+        : id_{id}, price_{price}, qty_{qty} {}
+
+  private:
+    friend struct tr::reflection<order>;
+
+    int id_;
+    double price_;
+    int qty_;
+};
+
+struct base {
+    int x;
+};
+
+struct derived : base {
+    int y;
+    int cache;
+};
+
+struct unregistered {};
+
+} // namespace
+
+TR_REFLECT(order, id_, price_, qty_);
+TR_REFLECT(derived, x, y);
+
+namespace {
+
+struct TestReflect {
+    void test_fields() {
+        static_assert(tr::is_reflected_v<order>);
+        static_assert(tr::is_reflected_v<derived const &>);
+        static_assert(!tr::is_reflected_v<unregistered>);
+
+        static_assert(field_count_v<order> == 3);
+        static_assert(field_count_v<derived> == 2);
+        static_assert(
+            decltype(tr::length(std::declval<derived &>()))::value == 2);
+    }
+
+    void test_names() {
+        static_assert(field_name_v<order, 0> == "id_");
+        static_assert(field_name_v<order, 2> == "qty_");
+        static_assert(tr::field_names<derived>()[1] == "y");
+        static_assert(tr::field_names<derived>().size() == 2);
+    }
+
+    void test_at() {
+        constexpr order o{7, 1.5, 3};
+        static_assert(at_c<0>(o) == 7);
+        static_assert(at_c<1>(o) == 1.5);
+
+        constexpr derived d{{1}, 2, 3};
+        static_assert(at_c<0>(d) == 1);
+        static_assert(at_c<1>(d) == 2);
+
+        order mo{1, 2.0, 3};
+        static_assert(type_c<decltype(at_c<1>(mo))> == type_c<double &>);
+        static_assert(type_c<decltype(at_c<1>(std::as_const(mo)))> ==
+                      type_c<double const &>);
+        static_assert(type_c<decltype(at_c<1>(std::move(mo)))> ==
+                      type_c<double &&>);
+    }
+
+    void test_algorithms() {
+        constexpr order o{7, 1.5, 3};
+        static_assert(tr::unpack(o, [](int id, double price, int qty) {
+                          return id + price * qty;
+                      }) == 11.5);
+
+        constexpr derived d{{1}, 2, 3};
+        static_assert(tr::fold_left(d, 0, [](int acc, int x) {
+                          return acc + x;
+                      }) == 3);
+    }
+};
+
+} // namespace
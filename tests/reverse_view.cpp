@@ -1,9 +1,17 @@
 #include <tr/view/reverse_view.h>
 
 #include <tr/algorithm/all_of.h>
+#include <tr/tuple.h>
 #include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/view/drop_view.h>
 
+#include <utility>
+
+using tr::drop_c;
 using tr::reverse;
+using tr::tuple_view;
+using tr::type_c;
 
 namespace {
 
@@ -28,5 +36,25 @@ struct TestReverseView {
         static_assert(equal(fw | reverse | reverse, fw));
         static_assert(equal(rv | reverse | reverse, rv));
     }
+
+    void test_collapse() {
+        static constexpr int fw[]{1, 2, 3, 4, 5};
+        constexpr int rv[]{4, 3, 2};
+
+        // A chain of views is a single view over the original tuple.
+        auto nested = fw | reverse | drop_c<1> | reverse | drop_c<1>;
+        static_assert(
+            type_c<decltype(nested)> ==
+            type_c<tuple_view<int const(&)[5], std::index_sequence<1, 2, 3>>>);
+        static_assert(equal(fw | drop_c<1> | reverse | drop_c<1>, rv));
+
+        // An r-value view moves the tuple it owns into the resulting view.
+        using tuple_t = tr::tuple<int, int, int>;
+        static_assert(
+            type_c<decltype(tuple_t{1, 2, 3} | reverse | drop_c<1>)> ==
+            type_c<tuple_view<tuple_t, std::index_sequence<1, 0>>>);
+        static_assert(equal(tuple_t{1, 2, 3} | reverse | drop_c<1>,
+                            tr::tuple<int, int>{2, 1}));
+    }
 };
 } // namespace
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+// Most checks of the test files are `static_assert`s, which run as the tests
+// are compiled. The checks which can only run at runtime (allocations, I/O,
+// SIMD kernels...) are gathered by each test file into a function declared
+// here, and called from `main`.
+
+void run_columns_view_tests();
+void run_hash_tests();
+void run_record_file_tests();
+void run_serialize_tests();
+void run_simd_tests();
+void run_soa_vector_tests();
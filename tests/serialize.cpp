@@ -0,0 +1,165 @@
+#include <tr/serialize.h>
+
+#include "runtime_tests.h"
+
+#include <tr/at.h>
+#include <tr/reflect.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/aggregate.h>
+#include <tr/tuple_protocol/built_in_array.h>
+#include <tr/tuple_protocol/std_pair.h>
+#include <tr/view/reverse_view.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using tr::serialized_size_v;
+using tr::tuple;
+
+namespace {
+
+enum class side : std::uint8_t { buy, sell };
+
+struct quote {
+    std::uint64_t id;
+    double price;
+    std::int32_t qty;
+    side dir;
+};
+
+class position {
+  public:
+    position() = default;
+    position(std::int16_t x, std::int16_t y) noexcept : x_{x}, y_{y} {}
+
+    [[nodiscard]] auto x() const noexcept -> std::int16_t { return x_; }
+
+  private:
+    friend struct tr::reflection<position>;
+
+    std::int16_t x_{};
+    std::int16_t y_{};
+};
+
+} // namespace
+
+TR_AGGREGATE_TUPLE(quote);
+TR_REFLECT(position, x_, y_);
+
+namespace {
+
+struct TestSerialize {
+    void test_size() {
+        static_assert(serialized_size_v<int> == sizeof(int));
+        static_assert(serialized_size_v<tuple<double, std::int64_t>> == 16);
+
+        // No padding between the elements.
+        static_assert(serialized_size_v<tuple<char, double>> == 9);
+        static_assert(serialized_size_v<quote> == 8 + 8 + 4 + 1);
+
+        // Nested tuple-like objects are flattened.
+        static_assert(
+            serialized_size_v<tuple<std::pair<int, bool>, float[3]>> == 17);
+        static_assert(serialized_size_v<position> == 4);
+    }
+
+    void test_memcpy_path() {
+        using tr::detail::is_memcpy_serializable_v;
+
+        static_assert(is_memcpy_serializable_v<tuple<double, std::int64_t>> ==
+                      TR_LITTLE_ENDIAN);
+        static_assert(is_memcpy_serializable_v<int[4]> == TR_LITTLE_ENDIAN);
+        static_assert(!is_memcpy_serializable_v<tuple<char, double>>);
+        static_assert(!is_memcpy_serializable_v<quote>);
+        static_assert(!is_memcpy_serializable_v<tuple<bool, bool>>);
+    }
+
+    void test_layout() {
+        tuple<std::uint16_t, std::int32_t> t{0x0102, -2};
+        std::byte buf[serialized_size_v<decltype(t)>];
+        auto *end = tr::serialize(buf, t);
+        assert(end == buf + 6);
+
+        // Little-endian, whatever the target.
+        assert(buf[0] == std::byte{0x02} && buf[1] == std::byte{0x01});
+        assert(buf[2] == std::byte{0xfe} && buf[5] == std::byte{0xff});
+    }
+
+    void test_round_trip() {
+        tuple<double, std::int64_t> t{1.5, -7};
+        std::vector<std::byte> buf;
+        tr::serialize(buf, t);
+        assert(buf.size() == 16);
+        auto const t2 = tr::deserialize<decltype(t)>(buf.data());
+        assert(tr::at_c<0>(t2) == 1.5 && tr::at_c<1>(t2) == -7);
+
+        quote q{42, 99.5, -3, side::sell};
+        std::string str{"header"};
+        tr::serialize(str, q);
+        assert(str.size() == 6 + serialized_size_v<quote>);
+        auto const q2 = tr::deserialize<quote>(
+            reinterpret_cast<std::byte const *>(str.data()) + 6);
+        assert(q2.id == 42 && q2.price == 99.5 && q2.dir == side::sell);
+
+        // Elements in the order of the view, not of the memory.
+        tuple<std::int32_t, std::int32_t> pair{1, 2};
+        std::byte rev[8];
+        tr::serialize(rev, pair | tr::reverse);
+        assert(tr::at_c<0>(tr::deserialize<decltype(pair)>(rev)) == 2);
+
+        std::byte pos[4];
+        tr::serialize(pos, position{3, 4});
+        assert(tr::deserialize<position>(pos).x() == 3);
+    }
+
+    void test_field_wise() {
+        // Padded, and `bool`s are stored as a single `0` or `1` byte.
+        using padded_t = tuple<bool, std::int64_t, bool>;
+        static_assert(!tr::detail::is_memcpy_serializable_v<padded_t>);
+
+        padded_t const t{true, -5, false};
+        std::byte buf[serialized_size_v<padded_t>];
+        assert(tr::serialize(buf, t) == buf + 10);
+        assert(buf[0] == std::byte{1} && buf[9] == std::byte{0});
+
+        auto const t2 = tr::deserialize<padded_t>(buf);
+        assert(tr::at_c<0>(t2) && tr::at_c<1>(t2) == -5 && !tr::at_c<2>(t2));
+    }
+
+    void test_nested() {
+        using nested_t =
+            tuple<std::pair<std::int32_t, bool>, float[3],
+                  tuple<std::uint16_t, tuple<double, char>>>;
+        static_assert(serialized_size_v<nested_t> == 5 + 12 + 2 + 9);
+
+        nested_t t{};
+        tr::at_c<0>(t) = {7, true};
+        tr::at_c<1>(t)[2] = 3.f;
+        tr::at_c<0>(tr::at_c<2>(t)) = 9;
+        tr::at_c<1>(tr::at_c<2>(t)) = tuple{0.5, 'z'};
+        std::vector<std::byte> buf;
+        tr::serialize(buf, t);
+        assert(buf.size() == serialized_size_v<nested_t>);
+
+        auto const t2 = tr::deserialize<nested_t>(buf.data());
+        assert(tr::at_c<0>(t2).first == 7 && tr::at_c<0>(t2).second);
+        assert(tr::at_c<1>(t2)[2] == 3.f);
+        assert(tr::at_c<0>(tr::at_c<2>(t2)) == 9);
+        assert(tr::at_c<0>(tr::at_c<1>(tr::at_c<2>(t2))) == 0.5);
+        assert(tr::at_c<1>(tr::at_c<1>(tr::at_c<2>(t2))) == 'z');
+    }
+};
+
+} // namespace
+
+void run_serialize_tests() {
+    TestSerialize t;
+    t.test_layout();
+    t.test_round_trip();
+    t.test_field_wise();
+    t.test_nested();
+}
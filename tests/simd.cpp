@@ -0,0 +1,140 @@
+#include <tr/simd.h>
+
+#include "runtime_tests.h"
+
+#include <tr/algorithm/all_of.h>
+#include <tr/algorithm/any_of.h>
+#include <tr/algorithm/fold_left.h>
+#include <tr/detail/simd.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/value_sequence.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+using tr::is_simd_tuple_v;
+using tr::lanewise;
+using tr::simd_element_t;
+using tr::tuple;
+using tr::type_c;
+
+namespace {
+
+using ints8_t = tuple<int, int, int, int, int, int, int, int>;
+
+/// @brief Check the SIMD kernels against the generic path, on `N` elements of
+/// type `T`.
+template <typename T, std::size_t N>
+void check_kernels() {
+    T data[N];
+    for (std::size_t i{}; i != N; ++i) {
+        data[i] = static_cast<T>(i % 7 + 1);
+    }
+
+    auto const sum = [](T x, T y) -> T { return x + y; };
+    assert(tr::fold_left(data, T{1}, lanewise(std::plus<>{})) ==
+           tr::fold_left(data, T{1}, sum));
+
+    if constexpr (std::is_integral_v<T>) {
+        auto const bitXor = [](T x, T y) -> T { return x ^ y; };
+        assert(tr::fold_left(data, T{}, std::bit_xor<>{}) ==
+               tr::fold_left(data, T{}, bitXor));
+    }
+
+    auto const nonZero = lanewise([](auto x) { return x != 0; });
+    auto const zero = lanewise([](auto x) { return x == 0; });
+    assert(tr::all_of(data, nonZero) && !tr::any_of(data, zero));
+
+    // The zero is in the first vector, in the last whole one, or among the
+    // remaining elements.
+    for (std::size_t i{}; i != N; ++i) {
+        T const prev = data[i];
+        data[i] = 0;
+        assert(!tr::all_of(data, nonZero) && tr::any_of(data, zero));
+        data[i] = prev;
+    }
+}
+
+struct TestSimd {
+    void test_simd_element() {
+        static_assert(type_c<simd_element_t<tuple<int, int>>> == type_c<int>);
+        static_assert(type_c<simd_element_t<float[3]>> == type_c<float>);
+        static_assert(type_c<simd_element_t<tuple<double>>> ==
+                      type_c<double>);
+
+        static_assert(is_simd_tuple_v<ints8_t>);
+        static_assert(!is_simd_tuple_v<tuple<>>);
+        static_assert(!is_simd_tuple_v<tuple<int, long>>);
+        static_assert(!is_simd_tuple_v<bool[4]>);
+        static_assert(!is_simd_tuple_v<std::string[4]>);
+        static_assert(!is_simd_tuple_v<tr::value_sequence<int, 1, 2>>);
+        static_assert(!is_simd_tuple_v<int>);
+    }
+
+    void test_dispatch() {
+        using tr::detail::is_simd_callable_v;
+        using tr::detail::is_simd_foldable_v;
+
+        using plus_t = tr::lanewise_t<std::plus<>>;
+        auto lambdaPlus = [](int x, int y) { return x + y; };
+
+        // 16 `int`s fill the widest vectors (AVX-512).
+        static_assert(is_simd_foldable_v<int[16], int, plus_t> == TR_HAS_SIMD);
+        static_assert(is_simd_foldable_v<int[16], int, std::plus<int>> ==
+                      TR_HAS_SIMD);
+        static_assert(!is_simd_foldable_v<ints8_t, long, plus_t>);
+        static_assert(!is_simd_foldable_v<ints8_t, int, decltype(lambdaPlus)>);
+        static_assert(!is_simd_foldable_v<double[8], double, std::plus<>>);
+        static_assert(!is_simd_foldable_v<int[1], int, plus_t>);
+
+        // Promoted to `int`.
+        static_assert(!is_simd_foldable_v<char[64], char, plus_t>);
+
+        static_assert(is_simd_callable_v<int[16], plus_t> == TR_HAS_SIMD);
+        static_assert(!is_simd_callable_v<ints8_t, decltype(lambdaPlus)>);
+    }
+
+    void test_constant_evaluation() {
+        constexpr ints8_t t{1, 2, 3, 4, 5, 6, 7, 8};
+
+        static_assert(tr::fold_left(t, 0, lanewise(std::plus<>{})) == 36);
+        static_assert(tr::fold_left(t, 0, std::bit_xor<>{}) == 8);
+        static_assert(
+            tr::all_of(t, lanewise([](auto x) { return x > 0; })));
+        static_assert(
+            !tr::any_of(t, lanewise([](auto x) { return x > 8; })));
+    }
+
+    void test_kernels() {
+        // Sizes which aren't a multiple of the number of lanes, whatever the
+        // width of the vectors.
+        check_kernels<int, 19>();
+        check_kernels<std::uint32_t, 37>();
+        check_kernels<std::int64_t, 5>();
+        check_kernels<float, 23>();
+        check_kernels<double, 7>();
+
+        // The elements of a tuple are copied into a buffer.
+        tuple<int, int, int, int, int, int, int, int, int, int, int> t{
+            1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        auto const plus = [](int x, int y) { return x + y; };
+        assert(tr::fold_left(t, 0, lanewise(std::plus<>{})) ==
+               tr::fold_left(t, 0, plus));
+        assert(tr::fold_left(t, 0, std::plus<int>{}) == 66);
+        assert(tr::all_of(t, lanewise([](auto x) { return x < 12; })));
+        assert(!tr::all_of(t, lanewise([](auto x) { return x < 11; })));
+        assert(tr::any_of(t, lanewise([](auto x) { return x == 11; })));
+        assert(!tr::any_of(t, lanewise([](auto x) { return x > 11; })));
+    }
+};
+} // namespace
+
+void run_simd_tests() {
+    TestSimd t;
+    t.test_kernels();
+}
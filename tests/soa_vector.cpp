@@ -0,0 +1,151 @@
+#include <tr/soa_vector.h>
+
+#include "runtime_tests.h"
+
+#include <tr/at.h>
+#include <tr/length.h>
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+#include <tr/unpack.h>
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+
+using tr::soa_column;
+using tr::soa_vector;
+using tr::type_c;
+
+using namespace tr::literals;
+
+namespace {
+
+struct TestSoaVector {
+    void test_types() {
+        using soa_t = soa_vector<int, float, std::uint8_t>;
+        static_assert(type_c<soa_t::reference> ==
+                      type_c<tr::tuple<int &, float &, std::uint8_t &>>);
+        static_assert(
+            type_c<soa_t::const_reference> ==
+            type_c<tr::tuple<int const &, float const &, std::uint8_t const &>>);
+
+        soa_t v;
+        static_assert(type_c<decltype(v[0])> == type_c<soa_t::reference>);
+        static_assert(type_c<decltype(std::as_const(v)[0])> ==
+                      type_c<soa_t::const_reference>);
+        static_assert(type_c<decltype(*v.begin())> ==
+                      type_c<soa_t::reference>);
+        static_assert(type_c<decltype(*std::as_const(v).begin())> ==
+                      type_c<soa_t::const_reference>);
+
+        static_assert(type_c<decltype(v.column(1_zuic))> ==
+                      type_c<soa_column<float>>);
+        static_assert(type_c<decltype(std::as_const(v).column(1_zuic))> ==
+                      type_c<soa_column<float const>>);
+    }
+
+    void test_tuple_protocol() {
+        soa_vector<int, std::string, double> v;
+
+        // A soa_vector is a tuple of columns.
+        static_assert(tr::length(v) == 3);
+        static_assert(type_c<decltype(tr::at_c<1>(v))> ==
+                      type_c<soa_column<std::string>>);
+
+        auto sizes = tr::unpack(v, [](auto... columns) {
+            return (columns.size() + ...);
+        });
+        assert(sizes == 0);
+
+        // Rows are tuples of references.
+        v.emplace_back(1, "one", 1.);
+        static_assert(decltype(tr::length(v[0]))::value == 3);
+        assert(tr::at_c<1>(v[0]) == "one");
+    }
+
+    void test_modifiers() {
+        soa_vector<int, float, float> v;
+        v.reserve(16);
+        assert(v.capacity() >= 16);
+        assert(v.empty());
+
+        v.emplace_back(0, 1.f, 2.f);
+        v.push_back(tr::tuple{1, 2.f, 3.f});
+        v.push_back({2, 3.f, 4.f});
+        assert(v.size() == 3);
+
+        for (auto [id, x, y] : v) {
+            x += y;
+            (void)id;
+        }
+
+        assert(v[1][1_zuic] == 5.f);
+
+        v.resize(5);
+        assert(v.size() == 5);
+        assert(v.back()[0_zuic] == 0);
+
+        v.pop_back();
+        assert(v.size() == 4);
+
+        v.clear();
+        assert(v.empty());
+    }
+
+    void test_alignment() {
+        soa_vector<char, double> v;
+        v.emplace_back('a', 1.);
+        auto address = reinterpret_cast<std::uintptr_t>(v.column(0_zuic).data());
+        assert(address % 64 == 0);
+    }
+
+    void test_std_columns() {
+        // `<tuple>` is included: indexing must not find `std::tie` through the
+        // `std::string` column.
+        soa_vector<int, std::string> v;
+        v.emplace_back(1, "one");
+        v.emplace_back(2, "two");
+        assert(tr::at_c<1>(v[1]) == "two");
+        assert(tr::at_c<1>(std::as_const(v)[0]) == "one");
+
+        tr::at_c<1>(v[0]) += "!";
+        assert(tr::at_c<1>(v.front()) == "one!");
+    }
+
+    void test_self_insertion() {
+        // Strings too long for the small string optimization: reading them
+        // after the columns grew would read freed memory.
+        std::string const str(32, 'a');
+        soa_vector<int, std::string> v;
+        v.emplace_back(1, str);
+        assert(v.size() == v.capacity());
+
+        v.push_back(v[0]);
+        assert(v.size() == v.capacity());
+        v.emplace_back(2, tr::at_c<1>(v[1]));
+
+        while (v.size() != v.capacity()) {
+            v.push_back(v.back());
+        }
+        v.push_back(v.back());
+
+        assert(v.size() > 4);
+        assert(tr::at_c<0>(v[1]) == 1 && tr::at_c<0>(v.back()) == 2);
+        for (auto [i, elem] : v) {
+            assert(elem == str);
+            (void)i;
+        }
+    }
+};
+} // namespace
+
+void run_soa_vector_tests() {
+    TestSoaVector t;
+    t.test_tuple_protocol();
+    t.test_modifiers();
+    t.test_alignment();
+    t.test_std_columns();
+    t.test_self_insertion();
+}
@@ -0,0 +1,70 @@
+#include <tr/span.h>
+
+#include <tr/algorithm/fold_left.h>
+#include <tr/at.h>
+#include <tr/simd.h>
+#include <tr/type_constant.h>
+#include <tr/unpack.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/reverse_view.h>
+
+#include <type_traits>
+
+using tr::drop_c;
+using tr::ic;
+using tr::reverse;
+using tr::span;
+using tr::type_c;
+
+namespace {
+
+struct TestSpan {
+    void test_span() {
+        static constexpr int buf[]{1, 2, 3, 4, 5, 6};
+
+        constexpr span<int const, 3> window{buf + 2};
+        static_assert(sizeof(window) == sizeof(int const *));
+        static_assert(std::is_trivially_copyable_v<span<int const, 3>>);
+        static_assert(window.size() == 3);
+        static_assert(window[ic<0>] == 3);
+        static_assert(window[2] == 5);
+        static_assert(&tr::at_c<1>(window) == &buf[3]);
+
+        constexpr span whole{buf};
+        static_assert(type_c<decltype(whole)> ==
+                      type_c<span<int const, 6> const>);
+        static_assert(whole.subspan<2, 3>().data() == window.data());
+        static_assert(whole.subspan<4>().size() == 2);
+
+        // The elements are l-values, whatever the value category of the span.
+        static_assert(type_c<decltype(tr::at_c<0>(span<int, 2>{nullptr}))> ==
+                      type_c<int &>);
+    }
+
+    void test_unpack() {
+        static constexpr int buf[]{1, 2, 3, 4, 5, 6};
+
+        constexpr auto weighted = tr::unpack(
+            span<int const, 3>{buf + 1},
+            [](int const &a, int const &b, int const &c) {
+                return &a == &buf[1] ? a + 10 * b + 100 * c : -1;
+            });
+        static_assert(weighted == 432);
+    }
+
+    void test_views() {
+        static constexpr int buf[]{1, 2, 3, 4, 5, 6};
+        constexpr span<int const, 4> window{buf + 1};
+
+        static_assert(tr::at_c<0>(window | reverse) == 5);
+        static_assert(tr::at_c<0>(window | drop_c<1>) == 3);
+        static_assert((window | drop_c<1>).begin() == &buf[2]);
+        static_assert(type_c<decltype(window.begin())> == type_c<int const *>);
+
+        static_assert(tr::is_simd_tuple_v<span<float, 8>>);
+        static_assert(tr::fold_left(window, 0, [](int acc, int x) {
+                          return acc + x;
+                      }) == 14);
+    }
+};
+} // namespace
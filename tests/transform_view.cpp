@@ -0,0 +1,107 @@
+#include <tr/view/transform_view.h>
+
+#include <tr/algorithm/all_of.h>
+#include <tr/algorithm/fold_left.h>
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/reverse_view.h>
+
+#include <functional>
+
+using tr::at_c;
+using tr::drop_c;
+using tr::reverse;
+using tr::transform;
+using tr::type_c;
+
+namespace {
+
+template <typename Tuple0, typename Tuple1>
+constexpr bool equal(Tuple0 &&lhs, Tuple1 &&rhs) {
+    using tr::length, tr::all_of, tr::at;
+    auto indices = tr::indices_for(lhs);
+    return (length(lhs) == length(rhs)) &&
+           all_of(indices, [&](auto i) { return at(lhs, i) == at(rhs, i); });
+}
+
+struct twice {
+    constexpr auto operator()(int x) const noexcept -> int { return 2 * x; }
+};
+
+struct point {
+    int x;
+    int y;
+};
+
+struct TestTransformView {
+    void test_transform() {
+        constexpr int arr[]{1, 2, 3, 4};
+        constexpr int doubled[]{2, 4, 6, 8};
+
+        static_assert(equal(arr | transform(twice{}), doubled));
+        static_assert((arr | transform(twice{})).size() == 4);
+        static_assert(sizeof(arr | transform(twice{})) == sizeof(int const *));
+
+        static constexpr tr::tuple t{1, 2.5, 'a'};
+        constexpr auto sizes =
+            t | transform([](auto const &x) { return sizeof(x); });
+        static_assert(at_c<1>(sizes) == sizeof(double));
+        static_assert(type_c<decltype(at_c<2>(sizes))> ==
+                      type_c<std::size_t>);
+
+        // Owns r-values.
+        static_assert(at_c<1>(tr::tuple{1, 2} | transform(twice{})) == 4);
+    }
+
+    void test_compose() {
+        constexpr int arr[]{1, 2, 3, 4};
+
+        static_assert(equal(arr | transform(twice{}) | drop_c<1>,
+                            tr::tuple{4, 6, 8}));
+        static_assert(equal(arr | drop_c<1> | transform(twice{}),
+                            tr::tuple{4, 6, 8}));
+        static_assert(equal(arr | transform(twice{}) | reverse,
+                            tr::tuple{8, 6, 4, 2}));
+        static_assert(equal(arr | transform(twice{}) | transform(twice{}),
+                            tr::tuple{4, 8, 12, 16}));
+
+        static_assert(tr::fold_left(arr | transform(twice{}) | drop_c<2>, 0,
+                                    std::plus<>{}) == 14);
+    }
+
+    void test_lazy() {
+        // Only the elements that are accessed are transformed.
+        constexpr int calls = [] {
+            int count{};
+            int const arr[]{1, 2, 3, 4};
+            auto view = arr | transform([&count](int x) {
+                            ++count;
+                            return x;
+                        }) |
+                        drop_c<3>;
+            return at_c<0>(view) + count * 10;
+        }();
+        static_assert(calls == 14);
+    }
+
+    void test_references() {
+        // Projections return references into the original tuple.
+        tr::tuple<point, point> points{};
+        auto xs = points | transform(&point::x);
+        static_assert(type_c<decltype(at_c<1>(xs))> == type_c<int &>);
+
+        auto const &cpoints = points;
+        auto cxs = cpoints | transform(&point::x);
+        static_assert(type_c<decltype(at_c<1>(cxs))> == type_c<int const &>);
+
+        constexpr auto assigned = [] {
+            tr::tuple<point, point> pts{};
+            at_c<1>(pts | transform(&point::y)) = 42;
+            return at_c<1>(pts).y;
+        }();
+        static_assert(assigned == 42);
+    }
+};
+} // namespace
@@ -476,5 +476,24 @@ struct TestTuple {
         int fourElems[]{0, 1, 2, 3};
         static_assert(length(fourElems) == 4);
     }
+
+    void test_equality() {
+        using tr::tuple;
+
+        static_assert(tuple{} == tuple{});
+        static_assert(tuple{1, 2.5} == tuple{1, 2.5});
+        static_assert(tuple{1, 2.5} != tuple{1, 3.});
+        static_assert(tuple{2, 2.5} != tuple{1, 2.5});
+
+        // Elements of different types are compared with `==`.
+        static_assert(tuple{1, 'a'} == tuple{1l, 97});
+
+        // Arrays are compared element by element, not by address.
+        constexpr char str[] = "hello";
+        constexpr tuple t0{0, str};
+        constexpr tuple t1{0, "hello"};
+        static_assert(t0 == t1);
+        static_assert(t0 != tuple{0, "world"});
+    }
 };
 } // namespace
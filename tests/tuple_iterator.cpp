@@ -0,0 +1,96 @@
+#include <tr/tuple_iterator.h>
+
+#include <tr/tuple.h>
+#include <tr/type_constant.h>
+#include <tr/value_sequence.h>
+#include <tr/view/drop_view.h>
+#include <tr/view/ref_view.h>
+#include <tr/view/reverse_view.h>
+#include <tr/view/transform_view.h>
+
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+using tr::detail::is_tuple_range_v;
+using tr::drop_c;
+using tr::reverse;
+using tr::type_c;
+
+namespace {
+
+template <typename Range>
+constexpr auto sum(Range &&range) -> int {
+    int res{};
+    for (int x : range) {
+        res += x;
+    }
+    return res;
+}
+
+template <typename It>
+using category_t = typename std::iterator_traits<It>::iterator_category;
+
+struct TestTupleIterator {
+    void test_tuple() {
+        static_assert(is_tuple_range_v<tr::tuple<int, int>>);
+        static_assert(is_tuple_range_v<tr::tuple<int, int> const>);
+        static_assert(!is_tuple_range_v<tr::tuple<int, long>>);
+        static_assert(!is_tuple_range_v<tr::tuple<>>);
+        static_assert(!is_tuple_range_v<int>);
+
+        using it_t = decltype(begin(std::declval<tr::tuple<int, int> &>()));
+        static_assert(type_c<category_t<it_t>> ==
+                      type_c<std::random_access_iterator_tag>);
+        static_assert(type_c<std::iterator_traits<it_t>::reference> ==
+                      type_c<int &>);
+
+        static_assert([] {
+            tr::tuple<int, int, int> t{1, 2, 3};
+            for (int &x : t) {
+                x *= 2;
+            }
+            auto it = begin(t);
+            return sum(t) == 12 && end(t) - it == 3 && it[2] == 6 &&
+                   *(end(t) - 3) == 2;
+        }());
+
+        using str_tuple_t = tr::tuple<std::string, std::string> const;
+        using str_it_t = decltype(begin(std::declval<str_tuple_t &>()));
+        static_assert(type_c<std::iterator_traits<str_it_t>::reference> ==
+                      type_c<std::string const &>);
+    }
+
+    void test_value_sequence() {
+        constexpr auto seq = tr::array_c<int, 1, 2, 3>;
+        static_assert(type_c<decltype(begin(seq))> == type_c<int const *>);
+        static_assert(sum(seq) == 6);
+
+        static_assert(!is_tuple_range_v<decltype(tr::tuple_c<1, 2u>)>);
+    }
+
+    void test_views() {
+        static constexpr int arr[]{1, 2, 3, 4, 5};
+
+        // Consecutive elements of an array are contiguous.
+        constexpr auto dropped = arr | drop_c<1>;
+        static_assert(type_c<decltype(dropped.begin())> == type_c<int const *>);
+        static_assert(dropped.begin() == &arr[1]);
+        static_assert(dropped.end() == &arr[5]);
+        static_assert(type_c<decltype(tr::ref(arr).begin())> ==
+                      type_c<int const *>);
+
+        // Other views go through the elements one by one.
+        constexpr auto reversed = arr | reverse | drop_c<1>;
+        static_assert(sum(reversed) == 10);
+        static_assert(*reversed.begin() == 4);
+
+        constexpr auto doubled =
+            arr | tr::transform([](int x) { return 2 * x; });
+        using it_t = decltype(doubled.begin());
+        static_assert(type_c<category_t<it_t>> ==
+                      type_c<std::input_iterator_tag>);
+        static_assert(sum(doubled) == 30);
+    }
+};
+} // namespace
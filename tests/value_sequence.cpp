@@ -1,5 +1,6 @@
 #include <tr/value_sequence.h>
 
+#include <tr/at.h>
 #include <tr/detail/utility.h>
 #include <tr/type_constant.h>
 
@@ -42,6 +43,13 @@ struct TestValueSequence {
             static_assert(type_c<decltype(t2)::value_type> == type_c<unsigned>);
             static_assert(decltype(t2){} == 2);
         }
+
+        {
+            auto tup = tuple_c<'0', 1l, 2u>;
+            static_assert(type_c<decltype(tr::at_c<1>(tup))> ==
+                          type_c<tr::value_constant<1l>>);
+            static_assert(tr::at_c<2>(array_c<int, 0, 2, 3>) == 3);
+        }
     }
 };
 
@@ -0,0 +1,54 @@
+#include <tr/visit_at.h>
+
+#include <tr/tuple.h>
+#include <tr/tuple_protocol/std_integer_sequence.h>
+#include <tr/type_constant.h>
+#include <tr/view/drop_view.h>
+
+#include <cstddef>
+#include <string>
+
+using tr::type_c;
+using tr::visit_at;
+
+namespace {
+
+struct to_int {
+    template <typename T>
+    constexpr auto operator()(T const &x) const noexcept -> int {
+        return static_cast<int>(x);
+    }
+};
+
+struct TestVisitAt {
+    void test_switch() {
+        constexpr tr::tuple t{1, 2l, 3u, '4'};
+        static_assert(visit_at(t, 0, to_int{}) == 1);
+        static_assert(visit_at(t, 2, to_int{}) == 3);
+        static_assert(visit_at(t, 3, to_int{}) == '4');
+    }
+
+    void test_table() {
+        // More elements than `detail::visit_at_switch_max`.
+        constexpr std::make_index_sequence<20> seq{};
+        static_assert(visit_at(seq, 0, to_int{}) == 0);
+        static_assert(visit_at(seq, 13, to_int{}) == 13);
+        static_assert(visit_at(seq, 19, to_int{}) == 19);
+
+        constexpr int arr[]{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        static_assert(visit_at(arr | tr::drop_c<2>, 5, to_int{}) == 7);
+    }
+
+    void test_references() {
+        tr::tuple<int, std::string> t{};
+        auto addressof = [](auto &x) -> void * { return &x; };
+        static_assert(type_c<decltype(visit_at(t, 1, addressof))> ==
+                      type_c<void *>);
+
+        tr::tuple<int, int> u{};
+        auto identity = [](int &x) -> int & { return x; };
+        static_assert(type_c<decltype(visit_at(u, 1, identity))> ==
+                      type_c<int &>);
+    }
+};
+} // namespace
@@ -0,0 +1,58 @@
+#include <tr/with_constant.h>
+
+#include <tr/type_constant.h>
+#include <tr/value_constant.h>
+
+#include <cstddef>
+
+using tr::type_c;
+using tr::with_constant;
+
+namespace {
+
+struct TestWithConstant {
+    void test() {
+        {
+            constexpr auto res = with_constant<0, 10>(7, [](auto v) {
+                return decltype(v)::value;
+            });
+            static_assert(res == 7);
+        }
+
+        {
+            // The bounds have the type of the value.
+            constexpr auto res = with_constant<std::size_t{1}, std::size_t{5}>(
+                std::size_t{4}, [](auto v) { return decltype(v)::value; });
+            static_assert(res == 4);
+
+            constexpr auto neg = with_constant<-3, 3>(-2, [](auto v) {
+                return decltype(v)::value;
+            });
+            static_assert(neg == -2);
+        }
+
+        {
+            constexpr auto res =
+                with_constant<1, 4>({3, 2}, [](auto r, auto c) {
+                    return decltype(r)::value * 10 + decltype(c)::value;
+                });
+            static_assert(res == 32);
+
+            constexpr auto res3 =
+                with_constant<0, 2>({1, 0, 1}, [](auto x, auto y, auto z) {
+                    return x * 4 + y * 2 + z;
+                });
+            static_assert(res3 == 5);
+        }
+
+        {
+            auto f = [](auto v) -> int const & {
+                static constexpr int val{decltype(v)::value};
+                return val;
+            };
+            static_assert(type_c<decltype(with_constant<0, 2>(1, f))> ==
+                          type_c<int const &>);
+        }
+    }
+};
+} // namespace